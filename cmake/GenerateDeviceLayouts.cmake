@@ -0,0 +1,243 @@
+# Compiles the device layouts (resources/layouts/*.json) into constant tables for src/configurations/DeviceLayout.h.
+# Runs at build time: cmake -DLAYOUT_DIR=<directory with the json files> -DOUTPUT=<header> -P GenerateDeviceLayouts.cmake
+#
+# Layout format:
+# {
+#     "build": "<DeviceBuild enum key>",
+#     "size": [<width>, <height>],                  // Size hint of the phone
+#     "zoneCounts": [<zones>, ...],                 // Supported amounts of zones in the light data, the first one is the default
+#     "decorations": [<element>, ...],              // Rendered below the glyphs, never colored
+#     "glyphs": [<element>, ...],
+#     "matrix": <matrix>                            // Optional
+# }
+# Element: {"name": "<optional>", "resource": "<qrc path>", "reference": "<MySvgRenderer::Reference key>",
+#           "offset": [<x>, <y>], "id": "<optional svg element>", "alignAbove": "<optional name of an earlier glyph>",
+#           "zones": [<zone for each entry of zoneCounts>]}   // "zones" only for glyphs
+# Matrix: An element (see above) whose svg contains all LEDs of a matrix plus
+#         "columns": <n>, "rows": <n>, "firstCell": [<x>, <y>, <width>, <height>], "pitch": [<x>, <y>] (svg units).
+#         Its "zones" are the zones of the first cell, the other cells follow row by row.
+
+cmake_minimum_required(VERSION 3.19)
+
+if(NOT LAYOUT_DIR OR NOT OUTPUT)
+    message(FATAL_ERROR "LAYOUT_DIR and OUTPUT must be set")
+endif()
+
+set(validReferences TOP_LEFT TOP_RIGHT BOTTOM_LEFT BOTTOM_RIGHT CENTERED CENTERED_H_BOTTOM CENTERED_H_TOP CENTERED_V_LEFT CENTERED_V_RIGHT)
+
+# Sets <outVar> to the C++ initializer of a GlyphLayout. Uses layoutFile and elementNames (names of the earlier elements).
+function(gv_element_initializer elementJson outVar)
+    string(JSON resource ERROR_VARIABLE error GET "${elementJson}" resource)
+    if(error)
+        message(FATAL_ERROR "${layoutFile}: Element without a resource: ${elementJson}")
+    endif()
+    string(JSON reference ERROR_VARIABLE error GET "${elementJson}" reference)
+    if(error OR NOT reference IN_LIST validReferences)
+        message(FATAL_ERROR "${layoutFile}: Invalid reference '${reference}' of '${resource}'. Expected one of: ${validReferences}")
+    endif()
+    string(JSON offsetX ERROR_VARIABLE error GET "${elementJson}" offset 0)
+    string(JSON offsetY ERROR_VARIABLE error GET "${elementJson}" offset 1)
+    if(error OR NOT offsetX MATCHES "^-?[0-9.]+$" OR NOT offsetY MATCHES "^-?[0-9.]+$")
+        message(FATAL_ERROR "${layoutFile}: Invalid offset of '${resource}'")
+    endif()
+    string(JSON id ERROR_VARIABLE error GET "${elementJson}" id)
+    if(error)
+        set(id "")
+    endif()
+    foreach(value IN ITEMS "${resource}" "${id}")
+        if(value MATCHES "[\"\\\\]")
+            message(FATAL_ERROR "${layoutFile}: '${value}' must not contain quotes or backslashes")
+        endif()
+    endforeach()
+
+    set(alignAboveIndex -1)
+    string(JSON alignAbove ERROR_VARIABLE error GET "${elementJson}" alignAbove)
+    if(NOT error)
+        list(FIND elementNames "${alignAbove}" alignAboveIndex)
+        if(alignAboveIndex EQUAL -1)
+            message(FATAL_ERROR "${layoutFile}: alignAbove '${alignAbove}' of '${resource}' must name an earlier glyph")
+        endif()
+    endif()
+
+    string(JSON name ERROR_VARIABLE error GET "${elementJson}" name)
+    set(comment "")
+    if(NOT error AND name)
+        set(comment " // ${name}")
+    endif()
+
+    set(${outVar} "    {\"${resource}\", MySvgRenderer::Reference::${reference}, ${offsetX}, ${offsetY}, \"${id}\", ${alignAboveIndex}},${comment}\n" PARENT_SCOPE)
+endfunction()
+
+file(GLOB layoutFiles "${LAYOUT_DIR}/*.json")
+list(SORT layoutFiles)
+if(NOT layoutFiles)
+    message(FATAL_ERROR "No device layouts found in ${LAYOUT_DIR}")
+endif()
+
+set(tables "")
+set(layouts "")
+set(builds "")
+foreach(layoutFile IN LISTS layoutFiles)
+    file(READ "${layoutFile}" json)
+    get_filename_component(layoutName "${layoutFile}" NAME_WE)
+    string(MAKE_C_IDENTIFIER "${layoutName}" layoutName)
+
+    string(JSON build ERROR_VARIABLE error GET "${json}" build)
+    if(error)
+        message(FATAL_ERROR "${layoutFile}: ${error}")
+    endif()
+    if(build IN_LIST builds)
+        message(FATAL_ERROR "${layoutFile}: There is already a layout for '${build}'")
+    endif()
+    list(APPEND builds "${build}")
+    string(JSON width ERROR_VARIABLE error GET "${json}" size 0)
+    string(JSON height ERROR_VARIABLE error GET "${json}" size 1)
+    if(error)
+        message(FATAL_ERROR "${layoutFile}: ${error}")
+    endif()
+
+    # Supported zone counts
+    string(JSON zoneCountsLength ERROR_VARIABLE error LENGTH "${json}" zoneCounts)
+    if(error OR zoneCountsLength EQUAL 0)
+        message(FATAL_ERROR "${layoutFile}: zoneCounts must not be empty")
+    endif()
+    math(EXPR lastZoneCount "${zoneCountsLength} - 1")
+    set(zoneCounts "")
+    foreach(z RANGE ${lastZoneCount})
+        string(JSON zoneCount GET "${json}" zoneCounts ${z})
+        list(APPEND zoneCounts ${zoneCount})
+        set(zones_${z} "")
+    endforeach()
+
+    # Decorations
+    set(decorationsTable "nullptr")
+    set(decorationCount 0)
+    string(JSON decorationCount ERROR_VARIABLE error LENGTH "${json}" decorations)
+    if(error)
+        set(decorationCount 0)
+    endif()
+    if(decorationCount GREATER 0)
+        set(elementNames "")
+        string(APPEND tables "constexpr GlyphLayout ${layoutName}Decorations[]{\n")
+        math(EXPR lastDecoration "${decorationCount} - 1")
+        foreach(i RANGE ${lastDecoration})
+            string(JSON decoration GET "${json}" decorations ${i})
+            gv_element_initializer("${decoration}" initializer)
+            string(APPEND tables "${initializer}")
+        endforeach()
+        string(APPEND tables "};\n")
+        set(decorationsTable "${layoutName}Decorations")
+    endif()
+
+    # Matrix
+    set(matrixTable "nullptr")
+    set(matrixCellCount 0)
+    string(JSON matrix ERROR_VARIABLE error GET "${json}" matrix)
+    if(NOT error)
+        set(elementNames "")
+        gv_element_initializer("${matrix}" initializer)
+        string(JSON columns ERROR_VARIABLE error GET "${matrix}" columns)
+        string(JSON rows ERROR_VARIABLE error GET "${matrix}" rows)
+        if(error OR NOT columns MATCHES "^[1-9][0-9]*$" OR NOT rows MATCHES "^[1-9][0-9]*$")
+            message(FATAL_ERROR "${layoutFile}: The matrix needs positive columns and rows")
+        endif()
+        set(cell "")
+        foreach(key IN ITEMS "firstCell;0" "firstCell;1" "firstCell;2" "firstCell;3" "pitch;0" "pitch;1")
+            string(JSON value ERROR_VARIABLE error GET "${matrix}" ${key})
+            if(error OR NOT value MATCHES "^-?[0-9.]+$")
+                message(FATAL_ERROR "${layoutFile}: The matrix needs a firstCell [x, y, width, height] and a pitch [x, y]")
+            endif()
+            string(APPEND cell ", ${value}")
+        endforeach()
+        math(EXPR matrixCellCount "${columns} * ${rows}")
+        string(APPEND tables "constexpr MatrixLayout ${layoutName}Matrix{\n${initializer}    ${columns}, ${rows}${cell}\n};\n")
+        set(matrixTable "&${layoutName}Matrix")
+    endif()
+
+    # Glyphs
+    string(JSON glyphCount ERROR_VARIABLE error LENGTH "${json}" glyphs)
+    if(error)
+        set(glyphCount 0)
+    endif()
+    if(glyphCount EQUAL 0 AND matrixCellCount EQUAL 0)
+        message(FATAL_ERROR "${layoutFile}: A layout needs glyphs or a matrix")
+    endif()
+    set(elementNames "")
+    set(glyphsTable "nullptr")
+    if(glyphCount GREATER 0)
+        string(APPEND tables "constexpr GlyphLayout ${layoutName}Glyphs[]{\n")
+        set(glyphsTable "${layoutName}Glyphs")
+    endif()
+    math(EXPR lastGlyph "${glyphCount} - 1")
+    foreach(i RANGE 0 ${lastGlyph})
+        if(lastGlyph LESS 0)
+            break()
+        endif()
+        string(JSON glyph GET "${json}" glyphs ${i})
+        gv_element_initializer("${glyph}" initializer)
+        string(APPEND tables "${initializer}")
+
+        string(JSON name ERROR_VARIABLE error GET "${glyph}" name)
+        if(error)
+            set(name "")
+        endif()
+        list(APPEND elementNames "${name}")
+
+        string(JSON glyphZoneCount ERROR_VARIABLE error LENGTH "${glyph}" zones)
+        if(error OR NOT glyphZoneCount EQUAL zoneCountsLength)
+            message(FATAL_ERROR "${layoutFile}: Glyph ${i} needs one zone for each of the zoneCounts (${zoneCounts})")
+        endif()
+        foreach(z RANGE ${lastZoneCount})
+            string(JSON zone GET "${glyph}" zones ${z})
+            list(GET zoneCounts ${z} zoneCount)
+            if(zone LESS 0 OR NOT zone LESS zoneCount)
+                message(FATAL_ERROR "${layoutFile}: Zone ${zone} of glyph ${i} is out of range for ${zoneCount} zones")
+            endif()
+            string(APPEND zones_${z} "${zone},")
+        endforeach()
+    endforeach()
+    if(glyphCount GREATER 0)
+        string(APPEND tables "};\n")
+    endif()
+
+    # Zone mappings
+    set(mappings "")
+    foreach(z RANGE ${lastZoneCount})
+        list(GET zoneCounts ${z} zoneCount)
+        set(zones "${layoutName}Zones${zoneCount}")
+        set(fanOut "${layoutName}FanOut${zoneCount}")
+        set(matrixZone -1)
+        if(matrixCellCount GREATER 0)
+            string(JSON matrixZone ERROR_VARIABLE error GET "${matrix}" zones ${z})
+            if(error)
+                message(FATAL_ERROR "${layoutFile}: The matrix needs one zone for each of the zoneCounts (${zoneCounts})")
+            endif()
+            math(EXPR matrixEnd "${matrixZone} + ${matrixCellCount}")
+            if(matrixZone LESS 0 OR matrixEnd GREATER zoneCount)
+                message(FATAL_ERROR "${layoutFile}: The matrix cells starting at zone ${matrixZone} are out of range for ${zoneCount} zones")
+            endif()
+        endif()
+        string(APPEND tables "constexpr std::array<quint16, ${glyphCount}> ${zones}{${zones_${z}}};\n")
+        string(APPEND tables "constexpr auto ${fanOut}{makeZoneFanOut<${zoneCount}>(${zones})};\n")
+        string(APPEND mappings "{${zoneCount}, ${matrixZone}, ${zones}.data(), ${fanOut}.offsets.data(), ${fanOut}.glyphs.data()}, ")
+    endforeach()
+    string(APPEND tables "constexpr ZoneMapping ${layoutName}ZoneMappings[]{${mappings}};\n\n")
+
+    string(APPEND layouts "    {DeviceBuild::${build}, ${width}, ${height}, ${glyphsTable}, ${glyphCount}, ${decorationsTable}, ${decorationCount}, ${matrixTable}, ${layoutName}ZoneMappings, ${zoneCountsLength}},\n")
+endforeach()
+
+file(WRITE "${OUTPUT}"
+"// Generated by cmake/GenerateDeviceLayouts.cmake from resources/layouts/*.json - do not edit!
+
+#ifndef GV_DEVICELAYOUTDATA_H
+#define GV_DEVICELAYOUTDATA_H
+
+namespace DeviceLayoutData {
+
+${tables}constexpr DeviceLayout layouts[]{
+${layouts}};
+
+} // namespace DeviceLayoutData
+
+#endif // GV_DEVICELAYOUTDATA_H
+")
@@ -51,10 +51,6 @@ copy "%BUILD_DIR%\GlyphVisualizer.exe" "%PORTABLE_DIR%"
 REM Run windeployqt
 windeployqt --release "%PORTABLE_DIR%\GlyphVisualizer.exe"
 
-REM Copy additional files
-REM   - zlib1.dll - might not exist if taglib was built with ZLIB=OFF
-if exist "%BUILD_DIR%\zlib1.dll" copy "%BUILD_DIR%\zlib1.dll" "%PORTABLE_DIR%"
-
 REM zip portable directory
 set "PORTABLE_ZIP=%BUILD_DIR%\GlyphVisualizer-%version%_windows-x64-portable.zip"
 powershell Compress-Archive -Path "%PORTABLE_DIR%" -DestinationPath "%PORTABLE_ZIP%"
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+
+# This file is part of the GlyphVisualizer project, a Glyph composition
+# player that plays Glyph compositions from Nothing phones.
+# Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import sys
+
+# Check the python version
+if sys.version_info < (3, 10):
+    print("This script requires Python 3.10 or higher! Please upgrade your python version and try again.")
+    sys.exit(1)
+
+import argparse
+import json
+import math
+import os
+import subprocess
+import tempfile
+import time
+
+# +------------------------------------+
+# |                                    |
+# |              Globals               |
+# |                                    |
+# +------------------------------------+
+
+# Name of the instant event that marks the end of the startup
+FIRST_PAINT_EVENT = "First GlyphWidget paint"
+
+# Percentiles that are reported
+PERCENTILES: list[int] = [50, 90, 95, 99]
+
+# +------------------------------------+
+# |                                    |
+# |           Bioler Plate             |
+# |                                    |
+# +------------------------------------+
+
+# Print critical error message and exit
+def print_critical_error(message: str, exitCode: int = 1, start: str = "", **args):
+    print_error(message, start, **args)
+    sys.exit(exitCode)
+
+# Print error message
+def print_error(message, start: str = "", **args):
+    print(str(start) + "ERROR: " + str(message), file=sys.stderr, flush=True, **args)
+
+# Print warning message
+def print_warning(message, start: str = "", **args):
+    print(str(start) + "WARNING: " + str(message), flush=True, **args)
+
+# Print info message
+def print_info(message, start: str = "", **args):
+    print(str(start) + "INFO: " + str(message), flush=True, **args)
+
+# +------------------------------------+
+# |                                    |
+# |             Functions              |
+# |                                    |
+# +------------------------------------+
+
+# Percentile with linear interpolation between the closest ranks
+def percentile(values: list[float], p: float) -> float:
+    ordered = sorted(values)
+    rank = (len(ordered) - 1) * p / 100
+    lower = math.floor(rank)
+    upper = math.ceil(rank)
+    return ordered[lower] + (ordered[upper] - ordered[lower]) * (rank - lower)
+
+# Launches the application once and returns the measurements in milliseconds (name -> value)
+def run_once(executable: str, timeout: float) -> dict[str, float]:
+    with tempfile.TemporaryDirectory() as temp_dir:
+        trace_path = os.path.join(temp_dir, "startup_trace.json")
+
+        env = dict(os.environ)
+        env.setdefault("QT_QPA_PLATFORM", "offscreen")
+
+        start = time.perf_counter()
+        try:
+            result = subprocess.run([executable, "--startup-trace", trace_path, "--exit-after-startup"], env=env, timeout=timeout,
+                                    stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+        except subprocess.TimeoutExpired:
+            raise RuntimeError(f"The application did not exit within {timeout}s!")
+        wall_time = (time.perf_counter() - start) * 1000
+
+        if result.returncode != 0:
+            raise RuntimeError(f"The application exited with code {result.returncode}:\n{result.stderr}")
+        if not os.path.isfile(trace_path):
+            raise RuntimeError("The application did not write a startup trace!")
+
+        with open(trace_path, 'r') as file:
+            trace = json.load(file)
+
+    # Trace timestamps are in microseconds
+    measurements: dict[str, float] = {}
+    for event in trace["traceEvents"]:
+        if event["ph"] == 'X':
+            # Events can appear multiple times (e.g. a configuration that is requested on two threads) - sum them up
+            measurements[event["name"]] = measurements.get(event["name"], 0) + event["dur"] / 1000
+        elif event["ph"] == 'i' and event["name"] == FIRST_PAINT_EVENT:
+            measurements[FIRST_PAINT_EVENT] = event["ts"] / 1000
+
+    if FIRST_PAINT_EVENT not in measurements:
+        raise RuntimeError(f"The startup trace does not contain the '{FIRST_PAINT_EVENT}' event!")
+    measurements["Process wall time"] = wall_time
+    return measurements
+
+def print_report(samples: dict[str, list[float]], runs: int):
+    name_width = max(len(name) for name in samples)
+    header = f"{'Event':<{name_width}}  {'n':>4}" + "".join(f"  {'p' + str(p):>9}" for p in PERCENTILES) + f"  {'max':>9}"
+    print(header)
+    print("-" * len(header))
+
+    # The milestones first, then the individual steps by their median
+    milestones = [FIRST_PAINT_EVENT, "Process wall time"]
+    steps = sorted((name for name in samples if name not in milestones), key=lambda name: -percentile(samples[name], 50))
+    for name in milestones + steps:
+        values = samples[name]
+        line = f"{name:<{name_width}}  {len(values):>4}"
+        line += "".join(f"  {percentile(values, p):>7.1f}ms" for p in PERCENTILES)
+        line += f"  {max(values):>7.1f}ms"
+        print(line)
+    print(f"\n{runs} runs. Steps with n < {runs} did not happen before the first paint in every run (e.g. the background warm-up).")
+
+# +------------------------------------+
+# |                                    |
+# |             Main Code              |
+# |                                    |
+# +------------------------------------+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Launches GlyphVisualizer offscreen multiple times and reports percentiles of the startup trace.")
+    parser.add_argument("executable", help="Path to the GlyphVisualizer executable")
+    parser.add_argument("--runs", type=int, default=20, help="Number of measured launches (default: %(default)s)")
+    parser.add_argument("--warmup", type=int, default=2, help="Number of launches that are not measured - fills the disk caches (default: %(default)s)")
+    parser.add_argument("--timeout", type=float, default=60, help="Seconds after which a launch is considered as hung (default: %(default)s)")
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.executable):
+        print_critical_error(f"The executable {args.executable!r} does not exist!")
+    if args.runs < 1:
+        print_critical_error("At least one run is required!")
+
+    samples: dict[str, list[float]] = {}
+    for i in range(args.warmup + args.runs):
+        measured = i >= args.warmup
+        try:
+            measurements = run_once(args.executable, args.timeout)
+        except RuntimeError as e:
+            print_critical_error(f"Run {i + 1} failed: {e}")
+
+        if not measured:
+            print_info(f"Warm-up run {i + 1}/{args.warmup} done")
+            continue
+        print_info(f"Run {i - args.warmup + 1}/{args.runs}: first paint after {measurements[FIRST_PAINT_EVENT]:.1f}ms")
+        for name, value in measurements.items():
+            samples.setdefault(name, []).append(value)
+
+    print()
+    print_report(samples, args.runs)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
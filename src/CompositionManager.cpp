@@ -24,66 +24,187 @@ Q_LOGGING_CATEGORY(compositionManager, "CompositionManager")
 Q_LOGGING_CATEGORY(compositionManagerVerbose, "CompositionManager.Verbose")
 
 CompositionManager::CompositionManager(QObject *parent)
-    : QObject{parent}, player{new QMediaPlayer{this}}, audioOutput{new QAudioOutput{this->player}}, tickTimer{new QTimer{this}},
-    elapsedTimer{new QElapsedTimer{}}, audioTimer{new QElapsedTimer{}}, waitTimer{new QDeadlineTimer{Qt::TimerType::PreciseTimer}},
-    audioResumeTimeMS{0}
+    : QObject{parent}, player{new QMediaPlayer{this}}, audioOutput{new QAudioOutput{this->player}}, compositionSource{}, seekTargetMS{-1}, seekTimer{}, tickTimer{new QTimer{this}},
+    audioTimer{new QElapsedTimer{}}, scrubTimer{new QTimer{this}}, scrubbing{false}, scrubPositionMS{-1}, audioResumeTimeMS{0}, lastTick{-1},
+    frames{}, waitingForFrames{false}
 {
     this->audioOutput->setVolume(0.4);
     connect(this->player, &QMediaPlayer::playbackStateChanged, this, &CompositionManager::onPlaybackStateChanged);
 
+    // The timer is rescheduled to the next tick boundary on every tick
     this->tickTimer->setTimerType(Qt::TimerType::PreciseTimer);
-    this->tickTimer->setInterval(CompositionManager::tickIntervalMSINT);
+    this->tickTimer->setSingleShot(true);
     connect(this->tickTimer, &QTimer::timeout, this, &CompositionManager::onTick);
 
+    // At most one scrub per tick - the first one is shown right away, the last one of a tick when it ends
+    this->scrubTimer->setTimerType(Qt::TimerType::PreciseTimer);
+    this->scrubTimer->setSingleShot(true);
+    this->scrubTimer->setInterval((int)Timeline::tickToMS(1));
+    connect(this->scrubTimer, &QTimer::timeout, this, &CompositionManager::onScrubTimer);
+
     // Forward all the signals
     connect(this->player, &QMediaPlayer::mediaStatusChanged, this, &CompositionManager::mediaStatusChanged);
-    connect(this->player, &QMediaPlayer::playbackStateChanged, this, &CompositionManager::playbackStateChanged);
+    connect(this->player, &QMediaPlayer::playbackStateChanged, this, [this]() { emit playbackStateChanged(playbackState()); });
     connect(this->player, &QMediaPlayer::durationChanged, this, &CompositionManager::durationChanged);
     connect(this->player, &QMediaPlayer::positionChanged, this, &CompositionManager::positionChanged);
+    connect(this->player, &QMediaPlayer::positionChanged, this, &CompositionManager::onPlayerPositionChanged);
 }
 CompositionManager::~CompositionManager() {
-    delete this->elapsedTimer;
     delete this->audioTimer;
-    delete this->waitTimer;
 }
 
 void CompositionManager::seek(qint64 position) {
+    // The scrubbing is over - the audio and the ticks continue from here
+    endScrubbing();
+
+    if (this->player->duration() > 0)
+        position = qBound((qint64)0, position, this->player->duration());
+    else
+        position = qMax((qint64)0, position);
+
+    this->seekTimer.start();
+    this->seekTargetMS = position;
     this->player->setPosition(position);
-    onPlaybackStateChanged(QMediaPlayer::PlaybackState::PausedState);
-    if (this->player->isPlaying())
-        onPlaybackStateChanged(QMediaPlayer::PlaybackState::PlayingState);
 
-    emit compositionTick(this->audioResumeTimeMS);
+    // player->position() can still be the old position until the backend caught up - the light data starts at the target
+    this->tickTimer->stop();
+    this->audioResumeTimeMS = position;
+    if (this->player->isPlaying()) {
+        this->audioTimer->start();
+        scheduleNextTick(positionNS());
+    } else {
+        this->audioTimer->invalidate();
+    }
+
+    this->lastTick = Timeline::tickFromMS(position);
+    emit discontinuity();
+    emit compositionTick(this->lastTick);
+    // Only the time until the tick is emitted - painting it is queued behind this
+    qCInfo(compositionManagerVerbose) << "Seek to" << position << "ms emitted tick" << this->lastTick << "after" << this->seekTimer.nsecsElapsed() / 1000 << "us";
+}
+
+void CompositionManager::scrub(qint64 position) {
+    this->scrubbing = true;
+    if (this->scrubTimer->isActive()) {
+        this->scrubPositionMS = position;
+        return;
+    }
+
+    // Small movements often stay in the same tick
+    qint64 tick{Timeline::tickFromMS(position)};
+    if (tick != this->lastTick) {
+        this->lastTick = tick;
+        emit discontinuity();
+        emit compositionTick(tick);
+    }
+    this->scrubTimer->start();
+}
+
+void CompositionManager::onScrubTimer() {
+    if (this->scrubPositionMS < 0)
+        return;
+
+    qint64 position{this->scrubPositionMS};
+    this->scrubPositionMS = -1;
+    scrub(position);
 }
 
-void CompositionManager::loadAudio(const QString& audioPath) {
-    qCInfo(compositionManager) << "Loading audio" << audioPath;
+void CompositionManager::endScrubbing() {
+    this->scrubbing = false;
+    this->scrubTimer->stop();
+    this->scrubPositionMS = -1;
+}
 
-    QFileInfo fileInfo{audioPath};
-    if (!fileInfo.isFile())
-        throw SourceFileException("The audio file '" + audioPath.toStdString() + "' could not be found!");
+void CompositionManager::loadAudio(QSharedPointer<const CompositionSource> source) {
+    // The source already made sure that the file exists and is playable
+    qCInfo(compositionManager) << "Loading audio" << source->audioPath();
 
     this->player->stop();
+    endScrubbing();
+    // A stopped player does not report the stop again
+    this->audioResumeTimeMS = 0;
+    this->lastTick = -1;
+    this->seekTargetMS = -1;
+    this->compositionSource = source;
     this->player->setAudioOutput(this->audioOutput);
-    this->player->setSource(QUrl::fromLocalFile(audioPath));
+    this->player->setSource(QUrl::fromLocalFile(source->audioPath()));
+}
+
+void CompositionManager::setFrames(FrameStore* frames) {
+    if (!this->frames.isNull())
+        disconnect(this->frames, nullptr, this, nullptr);
+
+    this->frames = frames;
+    setWaitingForFrames(false);
+    if (!this->frames.isNull()) {
+        connect(this->frames, &FrameStore::framesAppended, this, &CompositionManager::onFramesAppended);
+        connect(this->frames, &FrameStore::finished, this, &CompositionManager::onFramesAppended);
+    }
+}
+
+void CompositionManager::play() {
+    // Don't run into light data that is not parsed yet
+    qint64 tick{Timeline::tickFromNS(positionNS())};
+    if (!this->frames.isNull() && !this->frames->hasLead(tick)) {
+        qCInfo(compositionManagerVerbose) << "Waiting for the light data of tick" << tick << "before playing";
+        setWaitingForFrames(true);
+        return;
+    }
+
+    // The player reports the PlayingState itself, which is what the waiting state showed already
+    this->player->play();
+    this->waitingForFrames = false;
+}
+void CompositionManager::pause() {
+    this->player->pause();
+    setWaitingForFrames(false);
+}
+void CompositionManager::stop() {
+    this->player->stop();
+    setWaitingForFrames(false);
+}
+
+void CompositionManager::setWaitingForFrames(bool waiting) {
+    QMediaPlayer::PlaybackState oldState{playbackState()};
+    this->waitingForFrames = waiting;
+    if (playbackState() != oldState)
+        emit playbackStateChanged(playbackState());
+}
+
+qint64 CompositionManager::positionNS() const {
+    return this->audioResumeTimeMS * 1000000 + (this->audioTimer->isValid() ? this->audioTimer->nsecsElapsed() : 0);
+}
+
+void CompositionManager::scheduleNextTick(qint64 currentPositionNS) {
+    // Wake up at the start of the next tick (QTimer only has millisecond resolution - rather be late than early)
+    qint64 waitNS{Timeline::tickToNS(Timeline::tickFromNS(currentPositionNS) + 1) - currentPositionNS};
+    this->tickTimer->start((int)((waitNS + 999999) / 1000000));
 }
 
 void CompositionManager::onTick() {
-    // Get the elapsed time and restart the timer
-    qint64 elapsedTime{this->elapsedTimer->nsecsElapsed()};
-    this->elapsedTimer->start(); // Restart the timer
+    // The frame of the scrub position is shown - seek restarts the ticks
+    if (this->scrubbing)
+        return;
 
-    // Calculate the time we still have to wait
-    qint64 waitTime{CompositionManager::tickIntervalNS - elapsedTime};
+    qint64 position{positionNS()};
+    qint64 tick{Timeline::tickFromNS(position)};
 
-    // Wait if needed
-    if (waitTime > 400000) { // 0.4ms
-        this->waitTimer->setPreciseRemainingTime(0, waitTime, Qt::TimerType::PreciseTimer);
-        while (!this->waitTimer->hasExpired()) {}
+    // The parsing fell behind - wait for it instead of showing frames without light data
+    if (!this->frames.isNull() && !this->frames->hasLead(tick)) {
+        qCInfo(compositionManager) << "Light data is not parsed fast enough - waiting at tick" << tick;
+        // Set first, so the controls keep showing the PlayingState
+        setWaitingForFrames(true);
+        this->player->pause();
+        return;
     }
 
-    // Emit tick event
-    emit compositionTick(this->audioResumeTimeMS + this->audioTimer->elapsed());
+    // Only emit every tick once, even if the timer fires early
+    if (tick != this->lastTick) {
+        this->lastTick = tick;
+        emit compositionTick(tick);
+    }
+
+    scheduleNextTick(position);
 }
 
 void CompositionManager::onPlaybackStateChanged(QMediaPlayer::PlaybackState state) {
@@ -91,22 +212,51 @@ void CompositionManager::onPlaybackStateChanged(QMediaPlayer::PlaybackState stat
     case QMediaPlayer::PlaybackState::StoppedState:
         // Stop the timers
         this->tickTimer->stop();
-        this->elapsedTimer->invalidate();
         this->audioTimer->invalidate();
         this->audioResumeTimeMS = 0;
+        this->lastTick = -1;
+        this->seekTargetMS = -1;
         break;
     case QMediaPlayer::PlaybackState::PlayingState:
         // Start the timers
-        this->tickTimer->start();
-        this->elapsedTimer->start();
         this->audioTimer->start();
+        scheduleNextTick(positionNS());
         break;
     case QMediaPlayer::PlaybackState::PausedState:
-        // Stop the timers and save the paused position
+        // Stop the timers and save the paused position - the position of the player is stale until a seek is acknowledged
         this->tickTimer->stop();
-        this->elapsedTimer->invalidate();
+        if (this->seekTargetMS < 0)
+            this->audioResumeTimeMS = this->player->position();
+        else
+            this->audioResumeTimeMS = positionNS() / 1000000;
         this->audioTimer->invalidate();
-        this->audioResumeTimeMS = this->player->position();
         break;
     }
 }
+
+void CompositionManager::onPlayerPositionChanged(qint64 position) {
+    if (this->seekTargetMS < 0)
+        return;
+
+    // While playing the audio may already have moved on from the target
+    qint64 elapsedMS{this->player->isPlaying() ? this->seekTimer.elapsed() : 0};
+    if (position < this->seekTargetMS - CompositionManager::seekAcknowledgeToleranceMS
+        || position > this->seekTargetMS + elapsedMS + CompositionManager::seekAcknowledgeToleranceMS)
+        return;
+
+    qCInfo(compositionManagerVerbose) << "Audio followed the seek to" << this->seekTargetMS << "ms after" << this->seekTimer.elapsed() << "ms";
+    this->seekTargetMS = -1;
+
+    // The light clock started at the seek - move it to where the audio really is so it does not run ahead by the seek latency
+    this->audioResumeTimeMS = position;
+    emit discontinuity();
+    if (this->player->isPlaying()) {
+        this->audioTimer->start();
+        scheduleNextTick(positionNS());
+    }
+}
+
+void CompositionManager::onFramesAppended() {
+    if (this->waitingForFrames)
+        play();
+}
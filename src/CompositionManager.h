@@ -21,15 +21,19 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define GV_COMPOSITIONMANAGER_H
 
 #include <QAudioOutput>
-#include <QDeadlineTimer>
 #include <QElapsedTimer>
 #include <QFileInfo>
 #include <QMediaPlayer>
 #include <QObject>
+#include <QPointer>
+#include <QSharedPointer>
 #include <QString>
 #include <QTimer>
 #include <QUrl>
 
+#include "CompositionSource.h"
+#include "FrameStore.h"
+#include "Timeline.h"
 #include "Utils.h"
 
 // Logging
@@ -41,44 +45,77 @@ class CompositionManager : public QObject
 {
     Q_OBJECT
 public:
-    static constexpr qreal tickIntervalMS{16.666};
-    static constexpr int tickIntervalMSINT{(int)tickIntervalMS};
-    static constexpr qint64 tickIntervalNS{(qint64)(tickIntervalMS * 1e6)};
-
     explicit CompositionManager(QObject *parent = nullptr);
     ~CompositionManager();
 
-    bool isPlaying() const { return this->player->isPlaying(); }
+    // Waiting for the light data counts as playing - the playback continues on its own
+    QMediaPlayer::PlaybackState playbackState() const { return this->waitingForFrames ? QMediaPlayer::PlaybackState::PlayingState : this->player->playbackState(); }
+    bool isPlaying() const { return playbackState() == QMediaPlayer::PlaybackState::PlayingState; }
+    // The audio that is loaded - null before the first loadAudio
+    QSharedPointer<const CompositionSource> source() const { return this->compositionSource; }
     QString audioPath() const { return this->player->source().toLocalFile(); };
 
 signals:
-    void compositionTick(qint64 position);
+    // Emitted once per Timeline tick while playing and after seeking
+    void compositionTick(qint64 tick);
+    // The next compositionTick does not continue the playback (seek, scrub) - the ticks in between were not missed
+    void discontinuity();
     void mediaStatusChanged(QMediaPlayer::MediaStatus status);
+    // See playbackState
     void playbackStateChanged(QMediaPlayer::PlaybackState newState);
     void durationChanged(qint64 duration);
     void positionChanged(qint64 position);
 
 public slots:
     void seek(qint64 position);
-    void loadAudio(const QString& audioPath);
-    void play() { this->player->play(); };
-    void pause() { this->player->pause(); };
-    void stop() { this->player->stop(); }
+    // Shows the light data at position while the seek bar is dragged - the audio keeps playing until the next seek.
+    // Scrubs are coalesced to at most one per tick.
+    void scrub(qint64 position);
+    void loadAudio(QSharedPointer<const CompositionSource> source);
+    // The light data of the audio - the playback waits whenever the parsing falls behind (see FrameStore::playbackLeadFrames)
+    void setFrames(FrameStore* frames);
+    void play();
+    void pause();
+    void stop();
 
 private:
     QMediaPlayer* player;
     QAudioOutput* audioOutput;
 
+    QSharedPointer<const CompositionSource> compositionSource;
+
+    // The light data follows a seek right away, the audio backend reports the new position later.
+    // A position within this range around the target acknowledges the seek.
+    static constexpr qint64 seekAcknowledgeToleranceMS{50};
+    qint64 seekTargetMS; // -1 if the audio is where the light data is
+    QElapsedTimer seekTimer;
+
     QTimer* tickTimer;
-    QElapsedTimer* elapsedTimer;
     QElapsedTimer* audioTimer;
-    QDeadlineTimer* waitTimer;
+
+    // Ticks of the playback are not shown while scrubbing
+    QTimer* scrubTimer;
+    bool scrubbing;
+    qint64 scrubPositionMS; // The scrub that waits for the scrubTimer - -1 if none
 
     qint64 audioResumeTimeMS;
+    qint64 lastTick;
+
+    QPointer<FrameStore> frames;
+    bool waitingForFrames;
+
+    qint64 positionNS() const;
+    // Emits playbackStateChanged if waiting changes the playbackState
+    void setWaitingForFrames(bool waiting);
+    void endScrubbing();
+    void scheduleNextTick(qint64 currentPositionNS);
 
 private slots:
     void onTick();
+    void onPlayerPositionChanged(qint64 position);
+    void onScrubTimer();
     void onPlaybackStateChanged(QMediaPlayer::PlaybackState state);
+    void onFramesAppended();
 };
 
 #endif // GV_COMPOSITIONMANAGER_H
@@ -23,10 +23,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 Q_LOGGING_CATEGORY(compositionRenderer, "CompositionRenderer")
 Q_LOGGING_CATEGORY(compositionRendererVerbose, "CompositionRenderer.Verbose")
 
+const QRegularExpression CompositionRenderer::ffmpegSpeedExpression{QStringLiteral(R"(speed=\s*(\d+(?:\.\d+)?)x)")};
+
 CompositionRenderer::CompositionRenderer(QObject* parent)
     : QThread(parent), abortMutex{}, abortFlag{false}, ffmpegErrorFlag{false}, unexpectedErrorFlag{false}, progress{0}, ffmpegPath{},
     backgroundColor{}, glyphWidget{nullptr},
-    audioPath{}, config{nullptr}, outputPath{}, frameCount{0}
+    audioPath{}, config{nullptr}, outputPath{}, frameRate{Timeline::ticksPerSecond}, resampling{FrameResampling::Nearest}, frameCount{0}, frame{}, previousFrameColors{}, framesCursor{}, segmentFrameCount{0}, workDir{},
+    traceFilePath{}, trace{}, ffmpegOutput{}, ffmpegSpeed{-1}, windowFrames{0}, windowStartNS{0}, windowPaintNS{0}, windowHandoffNS{0}, windowWriteStallNS{0}
 {
     // Set up signals
     connect(this, &QThread::finished, this, &CompositionRenderer::onRenderingFinished);
@@ -42,30 +45,35 @@ CompositionRenderer::~CompositionRenderer() {
     delete this->config;
 }
 
-void CompositionRenderer::render(const QString& audioPath, IConfiguration* config, const QString& outputPath, const QSize& resolution, const QColor& backgroundColor, const QString& ffmpegPath) {
+void CompositionRenderer::render(QSharedPointer<const CompositionSource> source, IConfiguration* config, const QString& outputPath, const QSize& resolution, const QColor& backgroundColor, const QString& ffmpegPath,
+                                 int frameRate, FrameResampling resampling) {
     if (isRunning())
         throw std::logic_error("Can't render. The thread is already running!");
     if (resolution.width() % 2 || resolution.height() % 2)
         throw std::logic_error("Resolution must be even!");
+    if (frameRate <= 0)
+        throw std::logic_error("Frame rate must be positive!");
 
-    // Extract audio length
-    TagLib::FileRef f{audioPath.toStdString().c_str(), true, TagLib::AudioProperties::ReadStyle::Accurate};
-    if (f.isNull()) {
-        throw SourceFileException("Failed to open file '" + audioPath.toStdString() + "'!");
-    }
+    // The exact audio length was already taken from the Ogg granule positions when the composition was opened
+    const OggOpusReader::StreamInfo& streamInfo{source->streamInfo()};
 
     // Save the parameters
-    this->audioPath = audioPath;
+    this->audioPath = source->audioPath();
     this->outputPath = outputPath;
-    this->frameCount = f.audioProperties()->lengthInMilliseconds() / CompositionManager::tickIntervalMS;
+    this->workDir = QDir{outputPath + QStringLiteral(".parts")};
+    this->frameRate = frameRate;
+    this->segmentFrameCount = CompositionRenderer::segmentSeconds * frameRate;
+    this->resampling = resampling;
+    this->frameCount = Timeline::frameCount(streamInfo.sampleCount(), OggOpusReader::granuleRate, frameRate);
     this->backgroundColor = backgroundColor;
     setFFmpeg(ffmpegPath);
 
-    qCInfo(compositionRendererVerbose) << "Rendering" << this->audioPath << "with" << this->frameCount << "frames to" << outputPath;
+    qCInfo(compositionRendererVerbose) << "Rendering" << this->audioPath << "with" << this->frameCount << "frames at" << frameRate << "fps to" << outputPath;
 
     // Init the GlyphWidget
     delete this->glyphWidget;
     delete this->config;
+    config->waitForBounds(); // The GlyphWidget might still be rendering the masks of the original
     this->config = config->clone(); // Copy the config so we do not have a segfault on destruction
     this->glyphWidget = new GlyphWidget{this->config};
     this->glyphWidget->resize(resolution);
@@ -76,6 +84,7 @@ void CompositionRenderer::render(const QString& audioPath, IConfiguration* confi
     this->abortFlag = false;
     this->abortMutex.unlock();
     this->ffmpegErrorFlag = false;
+    this->progress = 0;
 
     // Start the thread
     qCInfo(compositionRenderer) << "Starting rendering";
@@ -83,6 +92,13 @@ void CompositionRenderer::render(const QString& audioPath, IConfiguration* confi
     start();
 }
 
+void CompositionRenderer::setTraceFilePath(const QString& traceFilePath) {
+    if (isRunning())
+        throw std::logic_error("Can't set the trace file. The thread is already running!");
+
+    this->traceFilePath = traceFilePath;
+}
+
 void CompositionRenderer::abort() {
     if (!isRunning()) {
         qCInfo(compositionRendererVerbose) << "Requested abort but thread is not running";
@@ -118,129 +134,428 @@ void CompositionRenderer::kill() {
 void CompositionRenderer::run() {
     try {
         qCInfo(compositionRenderer) << "Started rendering";
-        // Create ffmpeg process
-        QProcess ffmpegProcess{};
-        ffmpegProcess.setReadChannel(QProcess::ProcessChannel::StandardError);
-        /*
-         * We use bgra in the FFmpeg argument because of three reasons:
-         * 1. QPainter is optimized to render to the QImage::Format::Format_RGB32 and we don't want a format conversion
-         * 2. Somehow the raw data we get from the QImage in RGB32 format is saved as brga (0xBBGGRRff) - complete opposite as described in
-         * the QImage::Format table.
-         * 3. Formats like QImage::Format::Format_RGB888 are saved weirdly in memory resulting in a scrolling like video in both axies
-         * or a pipe break when using the rgb24 format as FFmpeg argument. But only for certain resolutions like QSize{898,1920}.
-         * QSize{1080,1920} works fine and returns the expected 1080*1920*3=6,220,800 bytes in image size where as the first mentioned
-         * resolution returns 5176320 bytes instead of the 898*1920*3=5,172,480 bytes - 2 bytes more per scanline. (Something something alignment?)
-         */
-        ffmpegProcess.start(
-            this->ffmpegPath,
-            {
-                QStringLiteral("-y"),
-                QStringLiteral("-hide_banner"),
-
-                QStringLiteral("-f"), QStringLiteral("rawvideo"),
-                QStringLiteral("-pix_fmt"), QStringLiteral("bgra"),
-                QStringLiteral("-s"), QStringLiteral("%1x%2").arg(this->glyphWidget->width()).arg(this->glyphWidget->height()),
-                QStringLiteral("-framerate"), QStringLiteral("60"),
-                QStringLiteral("-i"), QStringLiteral("-"),
-                QStringLiteral("-i"), this->audioPath,
-
-                QStringLiteral("-metadata"), QStringLiteral("composer=%1 %2").arg(QCoreApplication::applicationName()).arg(QCoreApplication::applicationVersion()),
-                QStringLiteral("-r"), QStringLiteral("60"),
-                QStringLiteral("-c:v"), QStringLiteral("libx264"),
-                QStringLiteral("-c:a"), QStringLiteral("aac"),
-                QStringLiteral("-pix_fmt"), QStringLiteral("yuv420p"),
-                this->outputPath
-            },
-            QIODeviceBase::OpenModeFlag::ReadWrite | QIODeviceBase::OpenModeFlag::Unbuffered
-        );
-        if (!ffmpegProcess.waitForStarted()) {
-            this->ffmpegErrorFlag = true;
-            emit ffmpegErrorOccurred(QStringLiteral("FFmpeg took to long to start."));
+
+        // Reset the profiling state
+        this->trace.clear();
+        this->ffmpegSpeed = -1;
+        this->windowFrames = 0;
+        this->windowStartNS = this->trace.elapsedNS();
+        this->windowPaintNS = this->windowHandoffNS = this->windowWriteStallNS = 0;
+
+        // Start with a complete frame
+        this->frame = QImage{};
+        this->previousFrameColors.clear();
+
+        qsizetype segmentCount{(this->frameCount + this->segmentFrameCount - 1) / this->segmentFrameCount};
+
+        // Resume from the last complete segment if a previous render of the same composition was interrupted
+        createPathIfNeeded(this->workDir);
+        qsizetype completedSegments{readCompletedSegments()};
+        if (completedSegments > 0) {
+            qCInfo(compositionRenderer).nospace() << "Resuming rendering at segment " << completedSegments + 1 << "/" << segmentCount;
+            this->progress = (qint8)qRound(qMin(completedSegments * this->segmentFrameCount, this->frameCount) * 100. / this->frameCount);
+            emit progressChanged(this->progress);
+        } else {
+            writeManifest(0);
+        }
+
+        // Render the segments
+        bool success{true};
+        for (qsizetype segment{completedSegments}; success && segment < segmentCount; ++segment) {
+            qint64 segmentStartNS{this->trace.elapsedNS()};
+            success = renderSegment(segment); // False if aborted or on error (already emitted)
+            if (!this->traceFilePath.isEmpty())
+                this->trace.addCompleteEvent(QStringLiteral("Segment %1").arg(segment + 1), segmentStartNS, this->trace.elapsedNS() - segmentStartNS);
+
+            if (success)
+                writeManifest(segment + 1);
+        }
+
+        // Join the segments and add the audio
+        if (success && !isAborted()) {
+            qint64 concatStartNS{this->trace.elapsedNS()};
+            success = concatSegments(segmentCount);
+            if (!this->traceFilePath.isEmpty())
+                this->trace.addCompleteEvent(QStringLiteral("Join segments"), concatStartNS, this->trace.elapsedNS() - concatStartNS);
+        }
+
+        if (!this->traceFilePath.isEmpty())
+            this->trace.write(this->traceFilePath);
+
+        if (!success || isAborted())
+            return;
+
+        // Everything went well => the segments are no longer needed
+        if (!this->workDir.removeRecursively())
+            qCWarning(compositionRenderer) << "Could not remove the segment directory" << this->workDir.absolutePath();
+    } catch (const std::exception& e) {
+        qCWarning(compositionRenderer) << "Unexpected Exception while rendering:" << e.what();
+        this->unexpectedErrorFlag = true;
+        emit unexpectedErrorOccurred(e.what());
+    }
+}
+
+bool CompositionRenderer::isAborted() {
+    QMutexLocker locker{&this->abortMutex};
+    return this->abortFlag;
+}
+
+void CompositionRenderer::ffmpegFailed(QProcess& ffmpegProcess, const QString& error, bool appendOutput) {
+    ffmpegProcess.kill();
+    ffmpegProcess.waitForFinished();
+    this->ffmpegErrorFlag = true;
+    if (appendOutput)
+        emit ffmpegErrorOccurred(QStringLiteral("%1:\n%2").arg(error).arg(readFFmpegOutput(ffmpegProcess)));
+    else
+        emit ffmpegErrorOccurred(error);
+}
+
+QString CompositionRenderer::readFFmpegOutput(QProcess& ffmpegProcess) {
+    QByteArray output{ffmpegProcess.readAllStandardError()};
+    if (!output.isEmpty()) {
+        // FFmpeg separates its progress lines with \r - the last match holds the current speed
+        QRegularExpressionMatchIterator it{CompositionRenderer::ffmpegSpeedExpression.globalMatch(QString::fromUtf8(output))};
+        while (it.hasNext()) {
+            bool ok{false};
+            qreal speed{it.next().captured(1).toDouble(&ok)};
+            if (ok) this->ffmpegSpeed = speed;
+        }
+
+        // Only keep the tail - it is used for the error messages
+        this->ffmpegOutput.append(output);
+        if (this->ffmpegOutput.size() > CompositionRenderer::maxFFmpegOutputSize)
+            this->ffmpegOutput.remove(0, this->ffmpegOutput.size() - CompositionRenderer::maxFFmpegOutputSize);
+    }
+    return QString::fromUtf8(this->ffmpegOutput);
+}
+
+void CompositionRenderer::recordFrame(qsizetype frame, qint64 paintStartNS, qint64 handoffStartNS, qint64 writeStallStartNS, qint64 frameEndNS) {
+    if (!this->traceFilePath.isEmpty()) {
+        this->trace.addCompleteEvent(QStringLiteral("Paint"), paintStartNS, handoffStartNS - paintStartNS);
+        this->trace.addCompleteEvent(QStringLiteral("Handoff"), handoffStartNS, writeStallStartNS - handoffStartNS);
+        this->trace.addCompleteEvent(QStringLiteral("Write stall"), writeStallStartNS, frameEndNS - writeStallStartNS);
+    }
+
+    this->windowFrames++;
+    this->windowPaintNS += handoffStartNS - paintStartNS;
+    this->windowHandoffNS += writeStallStartNS - handoffStartNS;
+    this->windowWriteStallNS += frameEndNS - writeStallStartNS;
+
+    qint64 windowNS{frameEndNS - this->windowStartNS};
+    if (windowNS < CompositionRenderer::statisticsIntervalNS && frame + 1 < this->frameCount)
+        return;
+
+    RenderStatistics statistics{};
+    statistics.framesRendered = frame + 1;
+    statistics.frameCount = this->frameCount;
+    statistics.framesPerSecond = this->windowFrames * 1e9 / qMax(windowNS, (qint64)1);
+    statistics.paintMS = this->windowPaintNS / 1e6 / this->windowFrames;
+    statistics.handoffMS = this->windowHandoffNS / 1e6 / this->windowFrames;
+    statistics.writeStallMS = this->windowWriteStallNS / 1e6 / this->windowFrames;
+    statistics.ffmpegSpeed = this->ffmpegSpeed;
+    if (this->ffmpegSpeed >= 0 && !this->traceFilePath.isEmpty())
+        this->trace.addCounterEvent(QStringLiteral("FFmpeg speed"), frameEndNS, this->ffmpegSpeed);
+
+    qCInfo(compositionRendererVerbose).nospace() << "Statistics: " << statistics.framesPerSecond << " fps, paint " << statistics.paintMS
+                                                 << " ms, handoff " << statistics.handoffMS << " ms, write stall " << statistics.writeStallMS
+                                                 << " ms, FFmpeg speed " << statistics.ffmpegSpeed << "x";
+    emit statisticsChanged(statistics);
+
+    this->windowFrames = 0;
+    this->windowStartNS = frameEndNS;
+    this->windowPaintNS = this->windowHandoffNS = this->windowWriteStallNS = 0;
+}
+
+QList<QColor> CompositionRenderer::frameColors(qsizetype frame) {
+    if (this->frameRate == Timeline::ticksPerSecond)
+        return this->config->colorsAt(frame, this->framesCursor);
+
+    // Measured in 1/(60 * frameRate) s: tick t spans [t * frameRate, (t + 1) * frameRate) and frame f spans [f * 60, (f + 1) * 60)
+    qint64 frameStart{frame * Timeline::ticksPerSecond};
+    qint64 frameEnd{frameStart + Timeline::ticksPerSecond};
+
+    if (this->resampling == FrameResampling::Nearest)
+        return this->config->colorsAt((frameStart + frameEnd) / 2 / this->frameRate, this->framesCursor);
+
+    // Blend - the overlaps always add up to 60
+    QList<QColor> colors{};
+    QList<int> sums{};
+    for (qint64 tick{frameStart / this->frameRate}; tick * this->frameRate < frameEnd; ++tick) {
+        int overlap{(int)(qMin(frameEnd, (tick + 1) * this->frameRate) - qMax(frameStart, tick * this->frameRate))};
+        colors = this->config->colorsAt(tick, this->framesCursor);
+        if (sums.isEmpty())
+            sums.resize(colors.size() * 3, 0);
+
+        for (qsizetype i{0}; i < colors.size() && i * 3 < sums.size(); ++i) {
+            const QColor& color{colors.at(i)};
+            sums[i * 3] += color.red() * overlap;
+            sums[i * 3 + 1] += color.green() * overlap;
+            sums[i * 3 + 2] += color.blue() * overlap;
+        }
+    }
+
+    constexpr int totalWeight{(int)Timeline::ticksPerSecond};
+    colors.resize(sums.size() / 3);
+    for (qsizetype i{0}; i < colors.size(); ++i) {
+        colors[i] = QColor{
+            (sums.at(i * 3) + totalWeight / 2) / totalWeight,
+            (sums.at(i * 3 + 1) + totalWeight / 2) / totalWeight,
+            (sums.at(i * 3 + 2) + totalWeight / 2) / totalWeight
+        };
+    }
+    return colors;
+}
+
+bool CompositionRenderer::startFFmpeg(QProcess& ffmpegProcess, const QStringList& arguments) {
+    this->ffmpegOutput.clear();
+    ffmpegProcess.setReadChannel(QProcess::ProcessChannel::StandardError);
+    ffmpegProcess.start(this->ffmpegPath, arguments, QIODeviceBase::OpenModeFlag::ReadWrite | QIODeviceBase::OpenModeFlag::Unbuffered);
+    if (!ffmpegProcess.waitForStarted()) {
+        ffmpegFailed(ffmpegProcess, QStringLiteral("FFmpeg took to long to start."), false);
+        return false;
+    }
+    return true;
+}
+
+bool CompositionRenderer::renderSegment(qsizetype segment) {
+    qsizetype firstFrame{segment * this->segmentFrameCount};
+    qsizetype lastFrame{qMin(firstFrame + this->segmentFrameCount, this->frameCount)};
+
+    // FFmpeg writes to a temporary file that only gets its final name once the segment is complete.
+    // That way a crash in the middle of a segment never leaves a truncated segment behind.
+    QString segmentPath{this->workDir.absoluteFilePath(segmentFileName(segment))};
+    QString partialSegmentPath{segmentPath + QStringLiteral(".partial")};
+    QFile::remove(segmentPath);
+
+    qCInfo(compositionRendererVerbose).nospace() << "Rendering segment " << segment + 1 << " (frames " << firstFrame + 1 << "-" << lastFrame << ") to " << segmentPath;
+
+    // Create ffmpeg process
+    QProcess ffmpegProcess{};
+    /*
+     * We use bgra in the FFmpeg argument because of three reasons:
+     * 1. QPainter is optimized to render to the QImage::Format::Format_RGB32 and we don't want a format conversion
+     * 2. Somehow the raw data we get from the QImage in RGB32 format is saved as brga (0xBBGGRRff) - complete opposite as described in
+     * the QImage::Format table.
+     * 3. Formats like QImage::Format::Format_RGB888 are saved weirdly in memory resulting in a scrolling like video in both axies
+     * or a pipe break when using the rgb24 format as FFmpeg argument. But only for certain resolutions like QSize{898,1920}.
+     * QSize{1080,1920} works fine and returns the expected 1080*1920*3=6,220,800 bytes in image size where as the first mentioned
+     * resolution returns 5176320 bytes instead of the 898*1920*3=5,172,480 bytes - 2 bytes more per scanline. (Something something alignment?)
+     */
+    if (!startFFmpeg(ffmpegProcess, {
+            QStringLiteral("-y"),
+            QStringLiteral("-hide_banner"),
+
+            QStringLiteral("-f"), QStringLiteral("rawvideo"),
+            QStringLiteral("-pix_fmt"), QStringLiteral("bgra"),
+            QStringLiteral("-s"), QStringLiteral("%1x%2").arg(this->glyphWidget->width()).arg(this->glyphWidget->height()),
+            QStringLiteral("-framerate"), QString::number(this->frameRate),
+            QStringLiteral("-i"), QStringLiteral("-"),
+
+            QStringLiteral("-r"), QString::number(this->frameRate),
+            QStringLiteral("-c:v"), QStringLiteral("libx264"),
+            QStringLiteral("-pix_fmt"), QStringLiteral("yuv420p"),
+            QStringLiteral("-f"), QStringLiteral("matroska"),
+            partialSegmentPath
+        }))
+        return false;
+
+    // Render the frames
+    for (qsizetype i{firstFrame}; i < lastFrame; ++i) {
+        // Check for abort
+        if (isAborted()) {
+            qCInfo(compositionRenderer) << "Abort received";
             ffmpegProcess.kill();
             ffmpegProcess.waitForFinished();
-            return;
+            QFile::remove(partialSegmentPath);
+            return false;
         }
 
-        // Render the frames
-        for (qsizetype i{0}; i < this->frameCount; ++i) {
-            // Check for abort
-            {
-                QMutexLocker locker{&this->abortMutex};
-                if (this->abortFlag) {
-                    qCInfo(compositionRenderer) << "Abort received";
-                    break;
-                }
-            }
+        // Render frame
+        qCInfo(compositionRendererVerbose).nospace() << "Rendering frame " << i+1 << "/" << this->frameCount;
+        qint64 paintStartNS{this->trace.elapsedNS()};
+        QList<QColor> colors{frameColors(i)};
+        if (this->frame.isNull() || !this->glyphWidget->updateRGB32Image(this->frame, colors, this->previousFrameColors, this->backgroundColor))
+            this->frame = this->glyphWidget->renderRGB32Image(colors, this->backgroundColor);
+        this->previousFrameColors = colors;
+        const QImage& image{this->frame};
+        qint64 handoffStartNS{this->trace.elapsedNS()};
+
+        // Check if we can write
+        if (!ffmpegProcess.isWritable()) {
+            qCWarning(compositionRenderer) << "FFmpeg pipe broken";
+            ffmpegFailed(ffmpegProcess, QStringLiteral("FFmpeg pipe broken"));
+            return false;
+        }
 
-            // Render frame
-            qCInfo(compositionRendererVerbose).nospace() << "Rendering frame " << i+1 << "/" << this->frameCount;
-            QImage image{this->glyphWidget->renderRGB32Image(i, this->backgroundColor)};
-
-            // Check if we can write
-            if (!ffmpegProcess.isWritable()) {
-                qCWarning(compositionRenderer) << "FFmpeg pipe broken";
-                ffmpegProcess.kill();
-                ffmpegProcess.waitForFinished();
-                this->ffmpegErrorFlag = true;
-                emit ffmpegErrorOccurred(QStringLiteral("FFmpeg pipe broken:\n%1").arg(ffmpegProcess.readAllStandardError()));
-                return;
-            }
+        // Check if we are still running
+        if (ffmpegProcess.state() != QProcess::ProcessState::Running) {
+            qCWarning(compositionRenderer) << "FFmpeg terminated prematurely";
+            ffmpegFailed(ffmpegProcess, QStringLiteral("FFmpeg terminated prematurely"));
+            return false;
+        }
 
-            // Check if we are still running
-            if (ffmpegProcess.state() != QProcess::ProcessState::Running) {
-                qCWarning(compositionRenderer) << "FFmpeg terminated prematurely";
-                ffmpegProcess.kill();
-                ffmpegProcess.waitForFinished();
-                this->ffmpegErrorFlag = true;
-                emit ffmpegErrorOccurred(QStringLiteral("FFmpeg terminated prematurely:\n%1").arg(ffmpegProcess.readAllStandardError()));
-                return;
+        // Write the bytes synchronously
+        ffmpegProcess.write((const char*)image.constBits(), image.sizeInBytes());
+        qint64 writeStallStartNS{this->trace.elapsedNS()};
+        do {
+            if (!ffmpegProcess.waitForBytesWritten()) {
+                qCWarning(compositionRenderer) << "Could not write to FFmpeg";
+                ffmpegFailed(ffmpegProcess, QStringLiteral("Could not write to FFmpeg"));
+                return false;
             }
+        } while (ffmpegProcess.bytesToWrite());
 
-            // Write the bytes synchronously
-            ffmpegProcess.write((const char*)image.constBits(), image.sizeInBytes());
-            do {
-                if (!ffmpegProcess.waitForBytesWritten()) {
-                    qCWarning(compositionRenderer) << "Could not write to FFmpeg";
-                    ffmpegProcess.kill();
-                    ffmpegProcess.waitForFinished();
-                    this->ffmpegErrorFlag = true;
-                    emit ffmpegErrorOccurred(QStringLiteral("Could not write to FFmpeg:\n%1").arg(ffmpegProcess.readAllStandardError()));
-                    return;
-                }
-            } while (ffmpegProcess.bytesToWrite());
-
-            // Update the progress
-            qint8 progress{(qint8)qRound((i + 1.) / this->frameCount * 100.)};
-            if (progress != this->progress) {
-                this->progress = progress;
-                emit progressChanged(progress);
-            }
+        // Update the profiling data
+        readFFmpegOutput(ffmpegProcess);
+        recordFrame(i, paintStartNS, handoffStartNS, writeStallStartNS, this->trace.elapsedNS());
+
+        // Update the progress
+        qint8 progress{(qint8)qRound((i + 1.) / this->frameCount * 100.)};
+        if (progress != this->progress) {
+            this->progress = progress;
+            emit progressChanged(progress);
         }
+    }
+
+    // Close the ffmpeg process
+    qCInfo(compositionRendererVerbose) << "Finishing segment" << segment + 1;
+    ffmpegProcess.closeWriteChannel();
+    if (!ffmpegProcess.waitForFinished()) {
+        qCWarning(compositionRenderer) << "FFmpeg took to long to finish";
+        ffmpegFailed(ffmpegProcess, QStringLiteral("FFmpeg took to long to finish."), false);
+        return false;
+    }
+    if (ffmpegProcess.exitStatus() != QProcess::ExitStatus::NormalExit || ffmpegProcess.exitCode() != 0) {
+        if (isAborted())
+            return false;
+
+        qCWarning(compositionRenderer) << "FFmpeg terminated abnormally";
+        this->ffmpegErrorFlag = true;
+        emit ffmpegErrorOccurred(QStringLiteral("FFmpeg terminated abnormally:\n%1").arg(readFFmpegOutput(ffmpegProcess)));
+        return false;
+    }
+
+    // The segment is complete
+    if (!QFile::rename(partialSegmentPath, segmentPath))
+        throw std::runtime_error("Could not rename segment '" + partialSegmentPath.toStdString() + "'");
+
+    return true;
+}
 
-        // Close the ffmpeg process
-        qCInfo(compositionRenderer) << "Shutting down FFmpeg";
-        ffmpegProcess.closeWriteChannel();
-        if (!ffmpegProcess.waitForFinished()) {
-            qCWarning(compositionRenderer) << "FFmpeg took to long to finish";
+bool CompositionRenderer::concatSegments(qsizetype segmentCount) {
+    qCInfo(compositionRenderer) << "Joining" << segmentCount << "segments";
+
+    // Write the segment list for the concat demuxer - paths are relative to the list file
+    QString segmentListPath{this->workDir.absoluteFilePath(QStringLiteral("segments.txt"))};
+    QSaveFile segmentList{segmentListPath};
+    if (!segmentList.open(QIODeviceBase::OpenModeFlag::WriteOnly | QIODeviceBase::OpenModeFlag::Text))
+        throw std::runtime_error("Could not write segment list '" + segmentListPath.toStdString() + "'");
+    for (qsizetype segment{0}; segment < segmentCount; ++segment)
+        segmentList.write(QStringLiteral("file '%1'\n").arg(segmentFileName(segment)).toUtf8());
+    if (!segmentList.commit())
+        throw std::runtime_error("Could not write segment list '" + segmentListPath.toStdString() + "'");
+
+    // The video stream is copied as is - only the audio gets encoded
+    QProcess ffmpegProcess{};
+    if (!startFFmpeg(ffmpegProcess, {
+            QStringLiteral("-y"),
+            QStringLiteral("-hide_banner"),
+
+            QStringLiteral("-f"), QStringLiteral("concat"),
+            QStringLiteral("-safe"), QStringLiteral("0"),
+            QStringLiteral("-i"), segmentListPath,
+            QStringLiteral("-i"), this->audioPath,
+
+            QStringLiteral("-map"), QStringLiteral("0:v:0"),
+            QStringLiteral("-map"), QStringLiteral("1:a:0"),
+            QStringLiteral("-metadata"), QStringLiteral("composer=%1 %2").arg(QCoreApplication::applicationName()).arg(QCoreApplication::applicationVersion()),
+            QStringLiteral("-c:v"), QStringLiteral("copy"),
+            QStringLiteral("-c:a"), QStringLiteral("aac"),
+            this->outputPath
+        }))
+        return false;
+
+    // Joining can take a while for long compositions - keep checking for an abort
+    ffmpegProcess.closeWriteChannel();
+    while (ffmpegProcess.state() != QProcess::ProcessState::NotRunning && !ffmpegProcess.waitForFinished(CompositionRenderer::abortPollIntervalMS)) {
+        if (isAborted()) {
+            qCInfo(compositionRenderer) << "Abort received while joining the segments";
             ffmpegProcess.kill();
             ffmpegProcess.waitForFinished();
-            this->ffmpegErrorFlag = true;
-            emit ffmpegErrorOccurred(QStringLiteral("FFmpeg took to long to finish."));
-            return;
+            QFile::remove(this->outputPath);
+            return false;
         }
-        if (ffmpegProcess.exitStatus() != QProcess::ExitStatus::NormalExit || ffmpegProcess.exitCode() != 0) {
-            QMutexLocker locker{&this->abortMutex};
-            if (!this->abortFlag) {
-                qCWarning(compositionRenderer) << "FFmpeg terminated abnormally";
-                this->ffmpegErrorFlag = true;
-                emit ffmpegErrorOccurred(QStringLiteral("FFmpeg terminated abnormally:\n%1").arg(ffmpegProcess.readAllStandardError()));
-            }
+    }
+    if (ffmpegProcess.exitStatus() != QProcess::ExitStatus::NormalExit || ffmpegProcess.exitCode() != 0) {
+        qCWarning(compositionRenderer) << "FFmpeg terminated abnormally while joining the segments";
+        this->ffmpegErrorFlag = true;
+        emit ffmpegErrorOccurred(QStringLiteral("FFmpeg terminated abnormally while joining the segments:\n%1").arg(readFFmpegOutput(ffmpegProcess)));
+        return false;
+    }
+
+    return true;
+}
+
+QString CompositionRenderer::segmentFileName(qsizetype segment) {
+    return QStringLiteral("segment_%1.mkv").arg(segment, 5, 10, QLatin1Char('0'));
+}
+
+QJsonObject CompositionRenderer::manifestParameters() const {
+    // Everything that influences the rendered frames - a segment may only be reused if all of these match
+    QFileInfo audioFileInfo{this->audioPath};
+    return QJsonObject{
+        {QStringLiteral("version"), CompositionRenderer::manifestVersion},
+        {QStringLiteral("applicationVersion"), QCoreApplication::applicationVersion()},
+        {QStringLiteral("audioPath"), audioFileInfo.absoluteFilePath()},
+        {QStringLiteral("audioSize"), audioFileInfo.size()},
+        {QStringLiteral("audioLastModified"), audioFileInfo.lastModified().toMSecsSinceEpoch()},
+        {QStringLiteral("build"), (int)this->config->build},
+        {QStringLiteral("width"), this->glyphWidget->width()},
+        {QStringLiteral("height"), this->glyphWidget->height()},
+        {QStringLiteral("backgroundColor"), this->backgroundColor.name(QColor::NameFormat::HexArgb)},
+        {QStringLiteral("frameRate"), this->frameRate},
+        {QStringLiteral("resampling"), (int)this->resampling},
+        {QStringLiteral("frameCount"), (qint64)this->frameCount},
+        {QStringLiteral("segmentFrameCount"), (qint64)this->segmentFrameCount}
+    };
+}
+
+qsizetype CompositionRenderer::readCompletedSegments() const {
+    QFile manifestFile{this->workDir.absoluteFilePath(QStringLiteral("manifest.json"))};
+    if (!manifestFile.open(QIODeviceBase::OpenModeFlag::ReadOnly))
+        return 0;
+
+    QJsonObject manifest{QJsonDocument::fromJson(manifestFile.readAll()).object()};
+    QJsonObject parameters{manifestParameters()};
+    for (auto it{parameters.constBegin()}; it != parameters.constEnd(); ++it) {
+        if (manifest.value(it.key()) != it.value()) {
+            qCInfo(compositionRendererVerbose) << "Segment manifest does not match the current render (" << it.key() << ") - starting from the beginning";
+            return 0;
         }
-    } catch (const std::exception& e) {
-        qCWarning(compositionRenderer) << "Unexpected Exception while rendering:" << e.what();
-        this->unexpectedErrorFlag = true;
-        emit unexpectedErrorOccurred(e.what());
     }
+
+    // Only trust segments that still exist
+    qsizetype completedSegments{manifest.value(QStringLiteral("completedSegments")).toInteger()};
+    for (qsizetype segment{0}; segment < completedSegments; ++segment) {
+        if (!this->workDir.exists(segmentFileName(segment))) {
+            qCInfo(compositionRendererVerbose) << "Segment" << segment + 1 << "is missing";
+            return segment;
+        }
+    }
+    return completedSegments;
+}
+
+void CompositionRenderer::writeManifest(qsizetype completedSegments) const {
+    QJsonObject manifest{manifestParameters()};
+    manifest.insert(QStringLiteral("completedSegments"), (qint64)completedSegments);
+
+    // QSaveFile makes sure that we never end up with a half written manifest
+    QString manifestPath{this->workDir.absoluteFilePath(QStringLiteral("manifest.json"))};
+    QSaveFile manifestFile{manifestPath};
+    if (!manifestFile.open(QIODeviceBase::OpenModeFlag::WriteOnly) ||
+        manifestFile.write(QJsonDocument{manifest}.toJson()) < 0 ||
+        !manifestFile.commit())
+        throw std::runtime_error("Could not write the render manifest '" + manifestPath.toStdString() + "'");
 }
 
 void CompositionRenderer::setFFmpeg(const QString& ffmpegPath) {
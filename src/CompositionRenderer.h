@@ -22,22 +22,34 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include <QColor>
 #include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
 #include <QFileInfo>
 #include <QImage>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMetaType>
 #include <QMutex>
 #include <QMutexLocker>
 #include <QObject>
 #include <QProcess>
+#include <QRegularExpression>
+#include <QRegularExpressionMatchIterator>
+#include <QSaveFile>
+#include <QSharedPointer>
 #include <QSize>
 #include <QString>
+#include <QStringList>
 #include <QStringLiteral>
 #include <QThread>
 
-#include <fileref.h>
-#include <audioproperties.h>
-
 #include "CompositionManager.h"
+#include "CompositionSource.h"
+#include "OggOpusReader.h"
+#include "Timeline.h"
 #include "configurations/IConfiguration.h"
+#include "TraceWriter.h"
 #include "Utils.h"
 #include "widgets/GlyphWidget.h"
 
@@ -46,14 +58,34 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 Q_DECLARE_LOGGING_CATEGORY(compositionRenderer)
 Q_DECLARE_LOGGING_CATEGORY(compositionRendererVerbose)
 
+// Timings of the export pipeline, averaged over the frames since the last statisticsChanged signal
+struct RenderStatistics {
+    qsizetype framesRendered{0};
+    qsizetype frameCount{0};
+    qreal framesPerSecond{0};
+    qreal paintMS{0};       // Painting the frame with the GlyphWidget
+    qreal handoffMS{0};     // Handing the frame buffer to the FFmpeg pipe
+    qreal writeStallMS{0};  // Waiting for FFmpeg to accept the frame
+    qreal ffmpegSpeed{-1};  // Encoding speed reported by FFmpeg (1 = real time), negative if unknown
+};
+Q_DECLARE_METATYPE(RenderStatistics)
+
 class CompositionRenderer : public QThread
 {
     Q_OBJECT
 public:
+    // How the 60 Hz light data is mapped to the frames if the video frame rate differs
+    enum class FrameResampling {
+        Nearest, // Show the tick that contains the middle of the frame
+        Blend    // Average all ticks that overlap the frame, weighted by their overlap (models the persistence of the LEDs)
+    };
+
     explicit CompositionRenderer(QObject* parent = nullptr);
     ~CompositionRenderer();
 
-    void render(const QString& audioPath, IConfiguration* config, const QString& outputPath, const QSize& resolution, const QColor& backgroundColor = Qt::GlobalColor::black, const QString& ffmpegPath = QString{});
+    void render(QSharedPointer<const CompositionSource> source, IConfiguration* config, const QString& outputPath, const QSize& resolution, const QColor& backgroundColor = Qt::GlobalColor::black, const QString& ffmpegPath = QString{},
+                int frameRate = Timeline::ticksPerSecond, FrameResampling resampling = FrameResampling::Nearest);
+    void setTraceFilePath(const QString& traceFilePath);
 
 public slots:
     void abort();
@@ -62,6 +94,7 @@ public slots:
 
 signals:
     void progressChanged(qint8 progress);
+    void statisticsChanged(const RenderStatistics& statistics);
     void ffmpegErrorOccurred(QString error);
     void renderingAborted();
     void renderingFinished();
@@ -85,9 +118,52 @@ private:
     QString audioPath;
     IConfiguration* config;
     QString outputPath;
+    int frameRate;
+    FrameResampling resampling;
     qsizetype frameCount;
+    // The last frame and its colors - the next frame only redraws the glyphs that changed
+    QImage frame;
+    QList<QColor> previousFrameColors;
+    // Where the render reads the frames of the config - its own, so the shown composition is not slowed down
+    FrameStore::Cursor framesCursor;
+
+    // Every segment is encoded into its own file inside a work directory next to the output.
+    // Completed segments are recorded in a manifest so an interrupted render can resume from there.
+    static constexpr qsizetype segmentSeconds{30};
+    qsizetype segmentFrameCount; // segmentSeconds at the frame rate of the render
+    static constexpr int manifestVersion{1};
+    // How often the joining of the segments checks for an abort
+    static constexpr int abortPollIntervalMS{100};
+    QDir workDir;
+
+    // Profiling
+    static constexpr qint64 statisticsIntervalNS{1000000000}; // 1s
+    static constexpr qsizetype maxFFmpegOutputSize{16 * 1024};
+    static const QRegularExpression ffmpegSpeedExpression;
+    QString traceFilePath;
+    TraceWriter trace;
+    QByteArray ffmpegOutput;
+    qreal ffmpegSpeed;
+    qsizetype windowFrames;
+    qint64 windowStartNS;
+    qint64 windowPaintNS;
+    qint64 windowHandoffNS;
+    qint64 windowWriteStallNS;
 
     void setFFmpeg(const QString& ffmpegPath);
+    bool isAborted();
+    void ffmpegFailed(QProcess& ffmpegProcess, const QString& error, bool appendOutput = true);
+    bool startFFmpeg(QProcess& ffmpegProcess, const QStringList& arguments);
+    bool renderSegment(qsizetype segment);
+    bool concatSegments(qsizetype segmentCount);
+    QString readFFmpegOutput(QProcess& ffmpegProcess);
+    QList<QColor> frameColors(qsizetype frame);
+    void recordFrame(qsizetype frame, qint64 paintStartNS, qint64 handoffStartNS, qint64 writeStallStartNS, qint64 frameEndNS);
+
+    static QString segmentFileName(qsizetype segment);
+    QJsonObject manifestParameters() const;
+    qsizetype readCompletedSegments() const;
+    void writeManifest(qsizetype completedSegments) const;
 private slots:
     void onRenderingFinished();
 };
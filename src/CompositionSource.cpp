@@ -0,0 +1,56 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "CompositionSource.h"
+
+// Logging
+Q_LOGGING_CATEGORY(compositionSource, "CompositionSource")
+Q_LOGGING_CATEGORY(compositionSourceVerbose, "CompositionSource.Verbose")
+
+CompositionSource::CompositionSource(const QString& audioPath)
+    : path{audioPath}, info{}, composerTag{}, lightData{}
+{
+    // Make sure the file exists
+    QFileInfo fileInfo{this->path};
+    if (!fileInfo.isFile())
+        throw SourceFileException("The audio file '" + this->path.toStdString() + "' could not be found!");
+    if (fileInfo.suffix() != QStringLiteral("ogg"))
+        throw SourceFileException("Wrong file extension! Only opus files with the .ogg extension are supported!");
+
+    // The reader also makes sure that the codec is opus
+    OggOpusReader::Probe probe{OggOpusReader{this->path}.probe()};
+    this->info = probe.streamInfo;
+
+    QList<QByteArrayView> composers{probe.tags.values("COMPOSER")};
+    if (composers.size() == 1)
+        this->composerTag = QString::fromUtf8(composers.first());
+
+    QList<QByteArrayView> authors{probe.tags.values("AUTHOR")};
+    if (authors.size() == 1) {
+        // The comment header is ours alone - cut it down to the value instead of copying it
+        qsizetype authorStart{authors.first().data() - probe.tags.packet.constData()};
+        qsizetype authorEnd{authorStart + authors.first().size()};
+        this->lightData = std::move(probe.tags.packet);
+        this->lightData.truncate(authorEnd);
+        this->lightData.remove(0, authorStart); // Only moves the start of the data
+    }
+
+    qCInfo(compositionSourceVerbose).nospace() << "Probed " << this->path << ": duration=" << this->info.durationMS()
+                                               << "ms, composer=" << this->composerTag << ", lightData=" << this->lightData.size() << " bytes";
+}
@@ -0,0 +1,65 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_COMPOSITIONSOURCE_H
+#define GV_COMPOSITIONSOURCE_H
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QFileInfo>
+#include <QList>
+#include <QString>
+#include <QStringLiteral>
+
+#include <utility>
+
+#include "OggOpusReader.h"
+#include "Utils.h"
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(compositionSource)
+Q_DECLARE_LOGGING_CATEGORY(compositionSourceVerbose)
+
+// The audio file of a composition. The file is probed once on construction (codec, duration and tags) and the
+// loader, the player and the exporter share the result instead of opening and parsing the file on their own.
+// The light data is big and only needed once - it is only kept until the loader takes it.
+class CompositionSource
+{
+public:
+    // Throws SourceFileException if the file is missing or not an Ogg Opus file
+    explicit CompositionSource(const QString& audioPath);
+
+    const QString& audioPath() const { return this->path; }
+    const OggOpusReader::StreamInfo& streamInfo() const { return this->info; }
+    qint64 durationMS() const { return this->info.durationMS(); }
+    // The value of the COMPOSER tag - null if there is not exactly one
+    const QString& composer() const { return this->composerTag; }
+
+    // The base64 encoded value of the AUTHOR tag - null if there is not exactly one or if it was already taken
+    QByteArray takeLightData() { return std::move(this->lightData); }
+
+private:
+    QString path;
+    OggOpusReader::StreamInfo info;
+    QString composerTag;
+    QByteArray lightData;
+};
+
+#endif // GV_COMPOSITIONSOURCE_H
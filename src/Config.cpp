@@ -29,7 +29,8 @@ const QMap<Config::Setting, QString> Config::settingsKeyMap = {
     {Config::Setting::UpdateChecker_LastAutoUpdateCheck_QDateTime, QStringLiteral("UpdateChecker/LastAutoUpdateCheck")},
     {Config::Setting::DonationDialog_DoNotShowAgain_Bool, QStringLiteral("Donation/DoNotShowAgain")},
     {Config::Setting::DonationDialog_LastShown_QDateTime, QStringLiteral("Donation/LastShown")},
-    {Config::Setting::FirstStart_Bool, QStringLiteral("FirstStart")}
+    {Config::Setting::FirstStart_Bool, QStringLiteral("FirstStart")},
+    {Config::Setting::LastDeviceBuild_Int, QStringLiteral("LastDeviceBuild")}
 };
 
 const QMap<Config::Setting, QVariant> Config::settingsDefaultValues = {
@@ -38,7 +39,8 @@ const QMap<Config::Setting, QVariant> Config::settingsDefaultValues = {
     {Config::Setting::UpdateChecker_LastAutoUpdateCheck_QDateTime, QDateTime::fromSecsSinceEpoch(0)},
     {Config::Setting::DonationDialog_DoNotShowAgain_Bool, false},
     {Config::Setting::DonationDialog_LastShown_QDateTime, QDateTime::fromSecsSinceEpoch(0)},
-    {Config::Setting::FirstStart_Bool, true}
+    {Config::Setting::FirstStart_Bool, true},
+    {Config::Setting::LastDeviceBuild_Int, (int)0} // DeviceBuild::Spacewar
 };
 
 Config::Config(QObject *parent)
@@ -51,7 +51,8 @@ public:
         UpdateChecker_LastAutoUpdateCheck_QDateTime = 2,
         DonationDialog_DoNotShowAgain_Bool = 3,
         DonationDialog_LastShown_QDateTime = 4,
-        FirstStart_Bool = 5
+        FirstStart_Bool = 5,
+        LastDeviceBuild_Int = 6
     };
     Q_ENUM(Setting)
 
@@ -0,0 +1,118 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FramePacer.h"
+
+// Logging
+Q_LOGGING_CATEGORY(framePacer, "FramePacer")
+Q_LOGGING_CATEGORY(framePacerVerbose, "FramePacer.Verbose")
+
+FramePacer::FramePacer(QObject* parent)
+    : QObject{parent}, stats{}, lastRequestedTick{-1}, paintPending{false}, paintTick{-1}, paintRequestTimer{}, paintTimer{new QTimer{this}},
+      deferredTick{-1}, deferredRequestTimer{}
+{
+    this->paintTimer->setSingleShot(true);
+    this->paintTimer->setInterval(FramePacer::paintTimeoutMS);
+    connect(this->paintTimer, &QTimer::timeout, this, &FramePacer::onPaintTimeout);
+}
+
+void FramePacer::resetStatistics() {
+    if (this->stats.paintedFrames > 0)
+        qCInfo(framePacer).nospace() << "Playback statistics: painted=" << this->stats.paintedFrames << ", dropped=" << this->stats.droppedFrames
+                                     << ", late=" << this->stats.lateFrames << ", maxLatency=" << this->stats.maxLatencyMS << "ms";
+
+    this->stats = PlaybackStatistics{};
+    this->lastRequestedTick = -1;
+    this->paintPending = false;
+    this->paintTick = -1;
+    this->paintTimer->stop();
+    this->deferredTick = -1;
+}
+
+void FramePacer::requestFrame(qint64 tick) {
+    // The playback jumps over the ticks it missed (e.g. while a paint blocked the event loop) - they are never shown.
+    // Only the gaps between the ticks of the playback count, seeks and scrubs reset lastRequestedTick.
+    if (this->lastRequestedTick >= 0 && tick > this->lastRequestedTick + 1)
+        this->stats.droppedFrames += tick - this->lastRequestedTick - 1;
+    this->lastRequestedTick = tick;
+
+    if (!this->paintPending) {
+        QElapsedTimer requestTimer{};
+        requestTimer.start();
+        render(tick, requestTimer);
+        return;
+    }
+
+    // Only the newest tick is rendered once the paint is done
+    if (this->deferredTick >= 0 && this->deferredTick != tick)
+        ++this->stats.droppedFrames;
+    this->deferredTick = tick;
+    this->deferredRequestTimer.start();
+}
+
+void FramePacer::framePainted(qsizetype tick) {
+    // Paints without a request (e.g. exposing the window) are not counted
+    if (!this->paintPending)
+        return;
+    this->paintPending = false;
+    this->paintTimer->stop();
+
+    // The widget showed another frame in the meantime
+    if (tick != this->paintTick) {
+        ++this->stats.droppedFrames;
+        renderDeferred();
+        return;
+    }
+
+    qint64 latencyNS{this->paintRequestTimer.nsecsElapsed()};
+    ++this->stats.paintedFrames;
+    if (latencyNS > Timeline::tickToNS(1))
+        ++this->stats.lateFrames;
+    this->stats.maxLatencyMS = qMax(this->stats.maxLatencyMS, latencyNS / 1000000.0);
+
+    if (this->stats.paintedFrames % Timeline::ticksPerSecond == 0)
+        qCInfo(framePacerVerbose).nospace() << "Painted " << this->stats.paintedFrames << " frames: dropped=" << this->stats.droppedFrames
+                                            << ", late=" << this->stats.lateFrames << ", maxLatency=" << this->stats.maxLatencyMS << "ms";
+
+    renderDeferred();
+}
+
+void FramePacer::onPaintTimeout() {
+    qCInfo(framePacerVerbose) << "Frame of tick" << this->paintTick << "was not painted after" << FramePacer::paintTimeoutMS << "ms";
+    this->paintPending = false;
+    ++this->stats.droppedFrames;
+    renderDeferred();
+}
+
+void FramePacer::render(qint64 tick, const QElapsedTimer& requestTimer) {
+    this->paintPending = true;
+    this->paintTick = tick;
+    this->paintRequestTimer = requestTimer;
+    this->paintTimer->start();
+    emit renderFrame((qsizetype)tick);
+}
+
+void FramePacer::renderDeferred() {
+    if (this->deferredTick < 0)
+        return;
+
+    qint64 tick{this->deferredTick};
+    this->deferredTick = -1;
+    render(tick, this->deferredRequestTimer);
+}
@@ -0,0 +1,89 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_FRAMEPACER_H
+#define GV_FRAMEPACER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+
+#include "Timeline.h"
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(framePacer)
+Q_DECLARE_LOGGING_CATEGORY(framePacerVerbose)
+
+struct PlaybackStatistics {
+    qint64 paintedFrames{0};
+    qint64 droppedFrames{0}; // Skipped by the playback or replaced by a newer frame before they were rendered
+    qint64 lateFrames{0};    // Painted more than one tick after they were requested
+    qreal maxLatencyMS{0};   // The longest time from requesting a frame until it was painted
+};
+
+// Sits between the ticks of the playback and the GlyphWidget. Only one frame is rendered at a time: the ticks that
+// arrive while its paint is pending are held back and only the newest of them is rendered once the paint is done,
+// so slow paints can't make the playback lag behind the audio. The frames that were dropped or painted late are counted
+// and logged (see statistics).
+class FramePacer : public QObject
+{
+    Q_OBJECT
+public:
+    // A paint that did not happen after this long (e.g. the window is hidden) is given up on
+    static constexpr int paintTimeoutMS{100};
+
+    explicit FramePacer(QObject* parent = nullptr);
+
+    const PlaybackStatistics& statistics() const { return this->stats; }
+    // Logs the statistics and starts over
+    void resetStatistics();
+
+signals:
+    void renderFrame(qsizetype tick);
+
+public slots:
+    void requestFrame(qint64 tick);
+    // The next tick does not follow the last one (e.g. a seek) - the ticks in between are not counted as dropped
+    void discontinuity() { this->lastRequestedTick = -1; }
+    // The GlyphWidget painted the frame of tick
+    void framePainted(qsizetype tick);
+
+private slots:
+    void onPaintTimeout();
+
+private:
+    PlaybackStatistics stats;
+    qint64 lastRequestedTick; // -1 after a reset or a discontinuity
+
+    // The frame that was rendered and waits for its paint
+    bool paintPending;
+    qint64 paintTick;
+    QElapsedTimer paintRequestTimer;
+    QTimer* paintTimer;
+
+    // The newest tick that arrived while the paint was pending - -1 if none
+    qint64 deferredTick;
+    QElapsedTimer deferredRequestTimer;
+
+    void render(qint64 tick, const QElapsedTimer& requestTimer);
+    void renderDeferred();
+};
+
+#endif // GV_FRAMEPACER_H
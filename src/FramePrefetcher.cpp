@@ -0,0 +1,172 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FramePrefetcher.h"
+
+// Logging
+Q_LOGGING_CATEGORY(framePrefetcher, "FramePrefetcher")
+Q_LOGGING_CATEGORY(framePrefetcherVerbose, "FramePrefetcher.Verbose")
+
+FramePrefetcher::FramePrefetcher()
+    : configuration{nullptr}, frames{}, framesCursor{}, base{}, pixelRatio{1.0}, configurationMutex{}, mutex{}, slots{}, firstFrame{0}, leasedFrame{-1},
+      workerRunning{false}, stopRequested{false}, worker{}, hits{0}, misses{0}
+{}
+FramePrefetcher::~FramePrefetcher() {
+    stop();
+}
+
+void FramePrefetcher::start(IConfiguration* configuration, const QImage& base, qreal pixelRatio) {
+    stop();
+
+    qCInfo(framePrefetcherVerbose) << "Prefetching" << FramePrefetcher::ringSize << "frames of" << base.size();
+    this->configuration = configuration;
+    // The configuration could get another composition while we render - keep the frames we started with
+    this->frames = configuration->frames;
+    this->base = base;
+    this->pixelRatio = pixelRatio;
+
+    QMutexLocker locker{&this->mutex};
+    this->slots = QList<Slot>(FramePrefetcher::slotCount);
+    this->firstFrame = 0;
+    this->leasedFrame = -1;
+    this->hits = 0;
+    this->misses = 0;
+}
+
+void FramePrefetcher::stop() {
+    {
+        QMutexLocker locker{&this->mutex};
+        this->stopRequested = true;
+    }
+    this->worker.waitForFinished();
+
+    if (isStarted())
+        qCInfo(framePrefetcherVerbose) << "Stopped prefetching -" << this->hits << "frames were ready," << this->misses << "were not";
+
+    QMutexLocker locker{&this->mutex};
+    this->stopRequested = false;
+    this->slots.clear();
+    this->configuration = nullptr;
+    this->frames.reset();
+    this->base = QImage{};
+}
+
+void FramePrefetcher::request(qsizetype frame) {
+    if (!isStarted() || this->frames.isNull())
+        return;
+
+    QMutexLocker locker{&this->mutex};
+    this->firstFrame = frame;
+    if (this->workerRunning)
+        return; // Picks up the new frames with its next job
+
+    qsizetype nextFrame{-1};
+    qsizetype slotIndex{-1};
+    if (!nextJob(nextFrame, slotIndex))
+        return;
+    this->workerRunning = true;
+    this->worker = QtConcurrent::run([this]() { run(); });
+}
+
+QImage FramePrefetcher::leaseFrame(qsizetype frame) {
+    QMutexLocker locker{&this->mutex};
+    for (const Slot& slot: this->slots) {
+        if (slot.frame == frame && !slot.image.isNull()) {
+            ++this->hits;
+            this->leasedFrame = frame;
+            return slot.image;
+        }
+    }
+    ++this->misses;
+    this->leasedFrame = -1;
+    return QImage{};
+}
+
+void FramePrefetcher::run() {
+    while (true) {
+        // Take the image out of its slot while rendering - leaseFrame() does not find it in the meantime
+        qsizetype frame{-1};
+        qsizetype slotIndex{-1};
+        Slot slot;
+        {
+            QMutexLocker locker{&this->mutex};
+            if (this->stopRequested || !nextJob(frame, slotIndex)) {
+                this->workerRunning = false;
+                return;
+            }
+            slot = std::move(this->slots[slotIndex]);
+            this->slots[slotIndex] = Slot{};
+        }
+
+        QList<QColor> colors;
+        bool rendered{false};
+        try {
+            colors = this->frames->at(frame, this->framesCursor);
+            QMutexLocker locker{&this->configurationMutex};
+            if (slot.image.isNull() || slot.colors.size() != colors.size()) {
+                // Start from the phone without any glyphs - invalid colors differ from all colors so everything is drawn
+                slot.image = this->base.copy();
+                slot.image.setDevicePixelRatio(this->pixelRatio);
+                slot.colors = QList<QColor>(colors.size());
+            }
+            rendered = this->configuration->renderChanges(slot.image, this->base, colors, slot.colors);
+        } catch (const std::exception& e) {
+            qCWarning(framePrefetcher) << "Could not render frame" << frame << e.what();
+        }
+
+        // Frames that could not be rendered keep their slot (with a null image) so they are not tried again
+        slot.frame = frame;
+        if (rendered) {
+            slot.colors = std::move(colors);
+        } else {
+            slot.image = QImage{};
+            slot.colors.clear();
+        }
+
+        QMutexLocker locker{&this->mutex};
+        this->slots[slotIndex] = std::move(slot);
+    }
+}
+
+bool FramePrefetcher::nextJob(qsizetype& frame, qsizetype& slotIndex) const {
+    // Only the frames that are already parsed
+    qsizetype lastFrame{qMin(this->firstFrame + FramePrefetcher::ringSize, this->frames->frameCount())};
+
+    for (frame = qMax((qsizetype)0, this->firstFrame); frame < lastFrame; ++frame) {
+        bool present{false};
+        for (const Slot& slot: this->slots)
+            present |= slot.frame == frame;
+        if (present)
+            continue;
+
+        // Reuse a slot with a frame outside of the ring - prefer the ones with an image (only the changes are redrawn).
+        // The leased frame is still shown, rendering into it would copy the image.
+        slotIndex = -1;
+        for (qsizetype i{0}; i < this->slots.size(); ++i) {
+            const Slot& slot{this->slots.at(i)};
+            bool outside{slot.frame < this->firstFrame || slot.frame >= this->firstFrame + FramePrefetcher::ringSize};
+            if (slot.frame >= 0 && slot.frame == this->leasedFrame)
+                continue;
+            if (outside && (slotIndex < 0 || !slot.image.isNull()))
+                slotIndex = i;
+        }
+        return slotIndex >= 0;
+    }
+    return false;
+}
@@ -0,0 +1,100 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_FRAMEPREFETCHER_H
+#define GV_FRAMEPREFETCHER_H
+
+#include <QColor>
+#include <QFuture>
+#include <QImage>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSharedPointer>
+#include <QtConcurrent/QtConcurrentRun>
+
+#include "configurations/IConfiguration.h"
+#include "FrameStore.h"
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(framePrefetcher)
+Q_DECLARE_LOGGING_CATEGORY(framePrefetcherVerbose)
+
+// Renders the frames after the playhead on the global thread pool into a ring of images, so painting a frame while
+// playing is only a blit. Every image of the ring is turned into its next frame by only redrawing the glyphs whose
+// color changed (see IConfiguration::renderChanges) - frames that can't be rendered that way are left to the caller.
+// While the prefetcher is started, the configuration must only be rendered with renderMutex() held and its
+// bounds must not change.
+class FramePrefetcher
+{
+public:
+    // The frames that are rendered ahead of the playhead (including the frame at the playhead)
+    static constexpr qsizetype ringSize{8};
+    // One more slot for the leased frame, so showing a frame does not cost a frame of the ring
+    static constexpr qsizetype slotCount{ringSize + 1};
+
+    FramePrefetcher();
+    ~FramePrefetcher();
+
+    // base is the frame without any glyphs in device pixels (see IConfiguration::renderDecorations)
+    void start(IConfiguration* configuration, const QImage& base, qreal pixelRatio);
+    // Waits for the running frame and drops all images
+    void stop();
+    bool isStarted() const { return this->configuration != nullptr; }
+
+    // Moves the ring to the frames starting at frame and renders the missing ones in the background
+    void request(qsizetype frame);
+    // The image of the frame or a null image if it is not rendered (yet). Its slot is not rendered into until the next
+    // leaseFrame, so the caller must drop the image before that - or the next render into the slot copies the whole image.
+    QImage leaseFrame(qsizetype frame);
+
+    QMutex& renderMutex() { return this->configurationMutex; }
+
+private:
+    struct Slot {
+        qsizetype frame{-1};
+        QImage image;             // Null if the slot was never used or the frame could not be rendered incrementally
+        QList<QColor> colors;     // The colors the image shows
+    };
+
+    IConfiguration* configuration;
+    QSharedPointer<FrameStore> frames;
+    FrameStore::Cursor framesCursor; // Only used by the worker
+    QImage base;
+    qreal pixelRatio;
+    QMutex configurationMutex;
+
+    // Guards everything below
+    QMutex mutex;
+    QList<Slot> slots;
+    qsizetype firstFrame;
+    qsizetype leasedFrame; // -1 if none
+    bool workerRunning;
+    bool stopRequested;
+    QFuture<void> worker;
+    qsizetype hits;
+    qsizetype misses;
+
+    void run();
+    // The next frame to render and the slot to render it into - false if all frames of the ring are there
+    bool nextJob(qsizetype& frame, qsizetype& slotIndex) const;
+};
+
+#endif // GV_FRAMEPREFETCHER_H
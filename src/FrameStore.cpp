@@ -0,0 +1,139 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "FrameStore.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+// Logging
+Q_LOGGING_CATEGORY(frameStore, "FrameStore")
+Q_LOGGING_CATEGORY(frameStoreVerbose, "FrameStore.Verbose")
+
+FrameStore::FrameStore(qsizetype zoneCount, const QList<QColor>& palette, QObject *parent)
+    : QObject{parent}, zones{zoneCount}, palette{palette}, lock{}, count{0}, keyframes{}, changes{}, changeEnds{}, complete{false},
+      lastValues(zoneCount, 0)
+{
+    if (zoneCount <= 0 || zoneCount > 0x10000)
+        throw std::logic_error("A FrameStore needs between 1 and 65536 zones!");
+    if (palette.isEmpty() || palette.size() > 0x10000)
+        throw std::logic_error("The palette of a FrameStore needs between 1 and 65536 colors!");
+}
+
+qsizetype FrameStore::frameCount() const {
+    QReadLocker locker{&this->lock};
+    return this->count;
+}
+
+bool FrameStore::isComplete() const {
+    QReadLocker locker{&this->lock};
+    return this->complete;
+}
+
+bool FrameStore::hasLead(qsizetype frame) const {
+    QReadLocker locker{&this->lock};
+    return this->complete || this->count >= frame + FrameStore::playbackLeadFrames;
+}
+
+QList<QColor> FrameStore::at(qsizetype frame, Cursor& cursor) const {
+    // Only waits for a running append
+    QReadLocker locker{&this->lock};
+    if (frame < 0 || frame >= this->count)
+        throw std::out_of_range("Frame " + std::to_string(frame) + " is not in the FrameStore (" + std::to_string(this->count) + " frames)!");
+
+    seek(frame, cursor);
+
+    QList<QColor> colors;
+    colors.reserve(this->zones);
+    for (quint16 value: cursor.values)
+        colors.append(this->palette.at(value));
+    return colors;
+}
+
+void FrameStore::seek(qsizetype frame, Cursor& cursor) const {
+    if (cursor.store != this) {
+        cursor.store = this;
+        cursor.frame = -1;
+        cursor.values = QList<quint16>(this->zones, 0);
+    }
+
+    // Start over at the keyframe unless we can continue from the last frame of the cursor
+    qsizetype keyframe{frame / FrameStore::keyframeInterval * FrameStore::keyframeInterval};
+    if (cursor.frame < keyframe || cursor.frame > frame) {
+        const quint16* values{this->keyframes.constData() + frame / FrameStore::keyframeInterval * this->zones};
+        std::copy(values, values + this->zones, cursor.values.begin());
+        cursor.frame = keyframe;
+    }
+
+    while (cursor.frame < frame) {
+        ++cursor.frame;
+        for (qsizetype i{this->changeEnds.at(cursor.frame - 1)}; i < this->changeEnds.at(cursor.frame); ++i) {
+            const Change& change{this->changes.at(i)};
+            cursor.values[change.zone] = change.value;
+        }
+    }
+}
+
+void FrameStore::append(const QList<QList<int>>& frames) {
+    qsizetype frameCount;
+    {
+        QWriteLocker locker{&this->lock};
+        if (this->complete)
+            throw std::logic_error("Can't append frames to a complete FrameStore!");
+
+        const int maxValue{(int)this->palette.size() - 1};
+        for (const QList<int>& frame: frames) {
+            if (frame.size() != this->zones)
+                throw std::logic_error("Frame has " + std::to_string(frame.size()) + " zones instead of " + std::to_string(this->zones) + "!");
+
+            bool isKeyframe{this->count % FrameStore::keyframeInterval == 0};
+            for (qsizetype zone{0}; zone < this->zones; ++zone) {
+                quint16 value{(quint16)qBound(0, frame.at(zone), maxValue)};
+                if (!isKeyframe && value != this->lastValues.at(zone))
+                    this->changes.append(Change{(quint16)zone, value});
+                this->lastValues[zone] = value;
+            }
+            if (isKeyframe)
+                this->keyframes.append(this->lastValues);
+            this->changeEnds.append(this->changes.size());
+            ++this->count;
+        }
+        frameCount = this->count;
+    }
+    emit framesAppended(frameCount);
+}
+
+qsizetype FrameStore::memoryUsage() const {
+    return this->keyframes.size() * sizeof(quint16) + this->changes.size() * sizeof(Change) + this->changeEnds.size() * sizeof(qsizetype);
+}
+
+void FrameStore::finish() {
+    {
+        QWriteLocker locker{&this->lock};
+        this->complete = true;
+        this->keyframes.squeeze();
+        this->changes.squeeze();
+        this->changeEnds.squeeze();
+
+        qCInfo(frameStoreVerbose).nospace() << "Complete with " << this->count << " frames, " << this->changes.size() << " changes and "
+                                            << this->keyframes.size() / this->zones << " keyframes in " << memoryUsage() / 1024 << " KiB"
+                                            << " (uncompressed " << this->count * this->zones * (qsizetype)sizeof(QColor) / 1024 << " KiB)";
+    }
+    emit finished();
+}
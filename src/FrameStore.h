@@ -0,0 +1,114 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_FRAMESTORE_H
+#define GV_FRAMESTORE_H
+
+#include <QColor>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QReadLocker>
+#include <QReadWriteLock>
+#include <QWriteLocker>
+
+#include "Timeline.h"
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(frameStore)
+Q_DECLARE_LOGGING_CATEGORY(frameStoreVerbose)
+
+// The colors of a composition - one list of zone colors per tick.
+// The store is filled while the composition is parsed, so playback can start before the whole light data is known:
+// the loader appends the frames on its thread and the player reads the ones that are already there.
+//
+// Most zones keep their brightness for many frames, so the frames are delta encoded: every keyframeInterval frames
+// all brightness values are stored (keyframe), the frames in between only store the zones that changed.
+// Reading a frame starts at its keyframe - or continues from the last frame the Cursor of the reader read when playing forward.
+// Reading does not change the store, so any number of threads can read at the same time.
+class FrameStore : public QObject
+{
+    Q_OBJECT
+public:
+    // The position of one reader - every reader (thread) needs its own
+    class Cursor {
+    public:
+        Cursor() : store{}, frame{-1}, values{} {}
+
+    private:
+        friend class FrameStore;
+        QPointer<const FrameStore> store; // The store the values are from - reset when the reader reads another one
+        qsizetype frame;
+        QList<quint16> values;
+    };
+
+    // Playback only starts (and continues) if this many frames ahead of the playhead are parsed
+    static constexpr qsizetype playbackLeadFrames{3 * Timeline::ticksPerSecond};
+    // At most this many frames of changes are applied to get any frame
+    static constexpr qsizetype keyframeInterval{64};
+
+    // palette maps the brightness values to the colors - values outside of it are clamped
+    FrameStore(qsizetype zoneCount, const QList<QColor>& palette, QObject *parent = nullptr);
+
+    qsizetype zoneCount() const { return this->zones; }
+    // Frames that can be read right now
+    qsizetype frameCount() const;
+    bool isComplete() const;
+    // True if the frames up to frame + playbackLeadFrames can be read (or the store is complete)
+    bool hasLead(qsizetype frame) const;
+
+    // frame must be in [0, frameCount()) - cursor is moved to frame
+    QList<QColor> at(qsizetype frame, Cursor& cursor) const;
+
+    // Loader side - every frame must have zoneCount brightness values
+    void append(const QList<QList<int>>& frames);
+    void finish();
+
+signals:
+    // Emitted from the thread of the loader
+    void framesAppended(qsizetype frameCount);
+    void finished();
+
+private:
+    // A zone that got a new brightness
+    struct Change {
+        quint16 zone;
+        quint16 value;
+    };
+
+    const qsizetype zones;
+    const QList<QColor> palette;
+
+    mutable QReadWriteLock lock;
+    qsizetype count;
+    // zones values per keyframe
+    QList<quint16> keyframes;
+    // The changes of frame f are changes[changeEnds[f - 1], changeEnds[f]) - keyframes have none
+    QList<Change> changes;
+    QList<qsizetype> changeEnds;
+    bool complete;
+    // The values of the last appended frame (loader side)
+    QList<quint16> lastValues;
+
+    void seek(qsizetype frame, Cursor& cursor) const;
+    qsizetype memoryUsage() const;
+};
+
+#endif // GV_FRAMESTORE_H
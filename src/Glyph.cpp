@@ -22,48 +22,104 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 Glyph::Glyph(const QString& filename, const Reference& reference, const QPointF& referenceOffset, const QString& id)
     : MySvgRenderer{filename, reference, referenceOffset, id}
 {
-    // Use the ARGB32_Premultiplied format because it is best optimized for rendering with QPainter
-    this->svgImage = QImage(QSize(1, 1), QImage::Format::Format_ARGB32_Premultiplied);
+    // Make sure that we have an valid mask of at least size 1x1 until calcBounds is called
+    this->coverageMask = QImage(QSize(1, 1), QImage::Format::Format_Alpha8);
+    this->coverageMask.fill(0);
 }
 Glyph::Glyph(const Glyph& g)
-    : MySvgRenderer{g}, svgImage{g.svgImage}
+    : MySvgRenderer{g}, coverageMask{g.coverageMask}, maskPosition{g.maskPosition}
 {}
 
+void Glyph::setMask(const QImage& coverageMask, const QPoint& maskPosition) {
+    if (coverageMask.format() != QImage::Format::Format_Alpha8)
+        throw std::logic_error("Glyph masks must use the Alpha8 format!");
+
+    this->coverageMask = coverageMask;
+    this->maskPosition = maskPosition;
+}
+
 void Glyph::renderColored(QPainter* painter, const QColor& color) {
+    // Fast path - blend the color directly into the pixels of the target image
+    if (compositeMask(painter, color))
+        return;
 
-    // Render the svg to a transparent image and then color it
+    // Color the mask in a transparent image and draw that instead
     // We don't know if the painter passed in draws on a transparent surface so we need to take this detour
+    QImage coloredImage{this->coverageMask.convertToFormat(QImage::Format::Format_ARGB32_Premultiplied)};
+    QPainter colorPainter(&coloredImage);
+    colorPainter.setCompositionMode(QPainter::CompositionMode::CompositionMode_SourceIn);
+    colorPainter.fillRect(coloredImage.rect(), color);
+    colorPainter.end();
+
+    // The mask already has the exact size - no filtering needed
+    painter->drawImage(this->maskPosition, coloredImage);
+}
+
+void Glyph::renderMask() {
+    // The mask covers all pixels the glyph touches - the sub pixel position is part of the rendered coverage
+    QRect maskRect{this->scaledAlignedBounds.toAlignedRect()};
+    maskRect.setSize(maskRect.size().expandedTo(QSize(1, 1))); // We get a QPainter error spam with empty images
+    this->maskPosition = maskRect.topLeft();
+    this->coverageMask = QImage(maskRect.size(), QImage::Format::Format_Alpha8);
 
-    // Copy svgImage that already has the svg prerendered with a transparent background for coloring
-    QImage copiedSvgImage = this->svgImage.copy();
-    QPainter svgPainter(&copiedSvgImage);
+    // Rasterize the svg with supersamplingFactor^2 samples per pixel and box filter them down to the coverage.
+    // This is done in horizontal strips to keep the memory usage low for big glyphs at 4K.
+    constexpr int factor{Glyph::supersamplingFactor};
+    constexpr int sampleCount{factor * factor};
+    int stripHeight{qMin(maskRect.height(), Glyph::maskStripHeight)};
+    QImage strip{maskRect.width() * factor, stripHeight * factor, QImage::Format::Format_ARGB32_Premultiplied};
+    for (int stripTop{0}; stripTop < maskRect.height(); stripTop += stripHeight) {
+        strip.fill(Qt::GlobalColor::transparent);
+        QPainter svgPainter(&strip);
+        svgPainter.scale(factor, factor);
+        svgPainter.translate(-maskRect.left(), -(maskRect.top() + stripTop));
+        MySvgRenderer::render(&svgPainter); // Svg rendering is expensive - that is why we only do it once per resize
+        svgPainter.end();
 
-    // Color the svg with the requested color
-    svgPainter.setCompositionMode(QPainter::CompositionMode::CompositionMode_SourceAtop);
-    svgPainter.fillRect(copiedSvgImage.rect(), color);
+        int rows{qMin(stripHeight, maskRect.height() - stripTop)};
+        for (int y{0}; y < rows; ++y) {
+            quint8* maskRow{this->coverageMask.scanLine(stripTop + y)};
+            for (int x{0}; x < maskRect.width(); ++x) {
+                int sum{0};
+                for (int sy{0}; sy < factor; ++sy) {
+                    const QRgb* samples{(const QRgb*)strip.constScanLine(y * factor + sy) + x * factor};
+                    for (int sx{0}; sx < factor; ++sx)
+                        sum += qAlpha(samples[sx]);
+                }
+                maskRow[x] = (quint8)((sum + sampleCount / 2) / sampleCount);
+            }
+        }
+    }
+}
+
+QImage* Glyph::directTarget(QPainter* painter, QPoint& translation) {
+    // Only possible if we can write the pixels of a 32 bit image directly and nothing but a whole pixel translation is applied
+    if (painter->device()->devType() != QInternal::PaintDeviceFlags::Image)
+        return nullptr;
+    if (painter->hasClipping() || painter->opacity() != 1.0 || painter->compositionMode() != QPainter::CompositionMode::CompositionMode_SourceOver)
+        return nullptr;
+
+    QTransform transform{painter->deviceTransform()};
+    if (transform.type() > QTransform::TransformationType::TxTranslate || transform.dx() != qRound(transform.dx()) || transform.dy() != qRound(transform.dy()))
+        return nullptr;
 
-    // Stop painting on the image and draw the image to the original painter
-    svgPainter.end();
-    painter->save();
-    painter->setRenderHints(QPainter::RenderHint::Antialiasing | QPainter::RenderHint::SmoothPixmapTransform);
-    painter->drawImage(this->scaledAlignedBounds, copiedSvgImage);
-    painter->restore();
+    QImage* image{static_cast<QImage*>(painter->device())};
+    if (image->format() != QImage::Format::Format_RGB32 && image->format() != QImage::Format::Format_ARGB32_Premultiplied)
+        return nullptr;
+
+    translation = QPoint{qRound(transform.dx()), qRound(transform.dy())};
+    return image;
 }
 
-void Glyph::calcBounds(const QRect& drawingArea, qreal scale) {
-    MySvgRenderer::calcBounds(drawingArea, scale);
-
-    // Adjust the size of the intermediate image
-    // Use the ARGB32_Premultiplied format because it is best optimized for rendering with QPainter
-    // Also make sure that we have an valid image of at least size 1x1. We get a QPainter error spam otherwise
-    // We double the scale to make the rendered SVG look good after rendering the image to the passed in painter
-    this->svgImage = QImage(this->scaledAlignedBounds.size().toSize().expandedTo(QSize(1, 1)) * 2, QImage::Format::Format_ARGB32_Premultiplied);
-
-    // Pre render svg to the image to save on processing. Svg rendering is expensive...
-    this->svgImage.fill(Qt::GlobalColor::transparent); // Make sure the image is transparent or the coloring won't work properly
-    QRectF savedAlignedBounds{this->scaledAlignedBounds};
-    this->scaledAlignedBounds = this->svgImage.rect().toRectF();
-    QPainter svgPainter(&this->svgImage);
-    MySvgRenderer::render(&svgPainter);
-    this->scaledAlignedBounds = savedAlignedBounds;
+bool Glyph::compositeMask(QPainter* painter, const QColor& color) {
+    if (color.alpha() != 255)
+        return false;
+
+    QPoint translation;
+    QImage* image{directTarget(painter, translation)};
+    if (image == nullptr)
+        return false;
+
+    MaskCompositor::blend(*image, this->maskPosition + translation, this->coverageMask, color.rgba());
+    return true;
 }
@@ -23,12 +23,15 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <QColor>
 #include <QImage>
 #include <QPainter>
+#include <QPoint>
 #include <QPointF>
 #include <QRect>
 #include <QRectF>
 #include <QSize>
 #include <QString>
+#include <QTransform>
 
+#include "MaskCompositor.h"
 #include "MySvgRenderer.h"
 
 class Glyph : public MySvgRenderer
@@ -38,11 +41,32 @@ public:
     explicit Glyph(const QString& filename, const Reference& reference, const QPointF& referenceOffset, const QString& id = QString());
     Glyph(const Glyph& g);
 
+    // Samples per pixel in each direction when pre rendering the mask
+    static constexpr int supersamplingFactor{4};
+
+    const QImage& getCoverageMask() const { return this->coverageMask; }
+    QPoint getMaskPosition() const { return this->maskPosition; }
+    // Replaces the mask, e.g. with one from the GlyphMaskCache
+    void setMask(const QImage& coverageMask, const QPoint& maskPosition);
+
     void renderColored(QPainter* painter, const QColor& color);
-    virtual void calcBounds(const QRect& drawingArea, qreal scale) override;
+    // Rasterizes the coverage mask for the bounds of the last calcBounds call.
+    // Glyphs are independent of each other, so different glyphs may render their masks in parallel.
+    void renderMask();
+
+    // Returns the 32 bit image the painter draws on if its pixels can be written directly (nothing but a whole pixel
+    // translation, which is stored in translation). nullptr if the painter has to be used.
+    static QImage* directTarget(QPainter* painter, QPoint& translation);
 
 private:
-    QImage svgImage;
+    // The mask is rasterized in strips of this many rows to limit the size of the supersampled image
+    static constexpr int maskStripHeight{64};
+
+    // 8 bit coverage of the glyph at the exact output resolution, positioned at maskPosition (device pixels)
+    QImage coverageMask;
+    QPoint maskPosition;
+
+    bool compositeMask(QPainter* painter, const QColor& color);
 };
 
 #endif // GV_GLYPH_H
@@ -0,0 +1,180 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "GlyphMaskCache.h"
+
+// Logging
+Q_LOGGING_CATEGORY(glyphMaskCache, "GlyphMaskCache")
+Q_LOGGING_CATEGORY(glyphMaskCacheVerbose, "GlyphMaskCache.Verbose")
+
+QByteArray GlyphMaskCache::calcKey(const QList<Glyph>& glyphs, QHash<QString, QByteArray>& resourceHashes) {
+    QCryptographicHash hash{QCryptographicHash::Algorithm::Sha256};
+    hash.addData(QByteArray::number(GlyphMaskCache::version));
+    hash.addData(QByteArray::number(Glyph::supersamplingFactor));
+
+    // Many glyphs share the same svg (e.g. the zones of one LED) - only hash every file once
+    for (const Glyph& g: glyphs) {
+        QString filename{g.getFilename()};
+        auto it{resourceHashes.constFind(filename)};
+        if (it == resourceHashes.constEnd()) {
+            QFile file{filename};
+            if (!file.open(QIODeviceBase::OpenModeFlag::ReadOnly))
+                throw std::logic_error("Could not open glyph file '" + filename.toStdString() + "'");
+            it = resourceHashes.insert(filename, QCryptographicHash::hash(file.readAll(), QCryptographicHash::Algorithm::Sha256));
+        }
+        hash.addData(it.value());
+        hash.addData(g.getId().toUtf8());
+
+        // The bounds include the sub pixel position which is part of the rendered mask
+        QRectF bounds{g.getScaledAlignedBounds()};
+        for (qreal value: {bounds.x(), bounds.y(), bounds.width(), bounds.height()})
+            hash.addData(QByteArrayView{(const char*)&value, sizeof(value)});
+    }
+
+    return hash.result();
+}
+
+bool GlyphMaskCache::load(DeviceBuild build, const QSize& targetSize, const QByteArray& key, QList<Glyph>& glyphs) {
+    QString filePath{};
+    try {
+        filePath = cacheFilePath(build, targetSize, key);
+    } catch (const std::exception& e) {
+        qCWarning(glyphMaskCache) << "Could not access the mask cache:" << e.what();
+        return false;
+    }
+
+    QFile file{filePath};
+    if (!file.open(QIODeviceBase::OpenModeFlag::ReadOnly)) {
+        qCInfo(glyphMaskCacheVerbose) << "No cached masks for" << build << targetSize;
+        return false;
+    }
+
+    QDataStream stream{&file};
+    stream.setVersion(QDataStream::Version::Qt_6_0);
+    quint32 fileMagic{0}, fileVersion{0}, glyphCount{0};
+    QByteArray fileKey{}, compressedMasks{};
+    stream >> fileMagic >> fileVersion >> fileKey >> glyphCount >> compressedMasks;
+    if (stream.status() != QDataStream::Status::Ok || fileMagic != GlyphMaskCache::magic || fileVersion != GlyphMaskCache::version
+        || fileKey != key || glyphCount != (quint32)glyphs.size()) {
+        qCWarning(glyphMaskCache) << "Ignoring invalid or outdated mask cache file" << filePath;
+        return false;
+    }
+
+    // Parse everything before touching the glyphs - a corrupt file must not leave half of the glyphs updated
+    QByteArray masks{qUncompress(compressedMasks)};
+    QDataStream masksStream{masks};
+    masksStream.setVersion(QDataStream::Version::Qt_6_0);
+    QList<QImage> images{};
+    QList<QPoint> positions{};
+    images.reserve(glyphs.size());
+    positions.reserve(glyphs.size());
+    for (qsizetype i{0}; i < glyphs.size(); ++i) {
+        qint32 x{0}, y{0}, width{0}, height{0};
+        masksStream >> x >> y >> width >> height;
+        // A mask covers at most the target area (plus the partially covered pixels on both sides)
+        if (masksStream.status() != QDataStream::Status::Ok || width <= 0 || height <= 0
+            || width > targetSize.width() + 2 || height > targetSize.height() + 2) {
+            qCWarning(glyphMaskCache) << "Ignoring corrupt mask cache file" << filePath;
+            return false;
+        }
+
+        QImage image{width, height, QImage::Format::Format_Alpha8};
+        if (image.isNull()) {
+            qCWarning(glyphMaskCache) << "Could not allocate a" << width << "x" << height << "mask for the mask cache file" << filePath;
+            return false;
+        }
+        for (int row{0}; row < height; ++row) {
+            if (masksStream.readRawData((char*)image.scanLine(row), width) != width) {
+                qCWarning(glyphMaskCache) << "Ignoring truncated mask cache file" << filePath;
+                return false;
+            }
+        }
+        images.append(std::move(image));
+        positions.append(QPoint{x, y});
+    }
+
+    for (qsizetype i{0}; i < glyphs.size(); ++i)
+        glyphs[i].setMask(images.at(i), positions.at(i));
+
+    qCInfo(glyphMaskCache) << "Loaded cached masks for" << build << targetSize;
+    return true;
+}
+
+void GlyphMaskCache::store(DeviceBuild build, const QSize& targetSize, const QByteArray& key, const QList<Glyph>& glyphs) {
+    // The cache is only an optimization - never fail because of it
+    try {
+        QByteArray masks{};
+        QDataStream masksStream{&masks, QIODeviceBase::OpenModeFlag::WriteOnly};
+        masksStream.setVersion(QDataStream::Version::Qt_6_0);
+        for (const Glyph& g: glyphs) {
+            const QImage& image{g.getCoverageMask()};
+            masksStream << (qint32)g.getMaskPosition().x() << (qint32)g.getMaskPosition().y() << (qint32)image.width() << (qint32)image.height();
+            for (int row{0}; row < image.height(); ++row)
+                masksStream.writeRawData((const char*)image.constScanLine(row), image.width());
+        }
+
+        QDir dir{cacheDir()};
+        QString filePath{cacheFilePath(build, targetSize, key)};
+        QSaveFile file{filePath};
+        if (!file.open(QIODeviceBase::OpenModeFlag::WriteOnly)) {
+            qCWarning(glyphMaskCache) << "Could not write mask cache file" << filePath << file.errorString();
+            return;
+        }
+
+        // Most of every mask is empty - even the fastest compression level shrinks it a lot
+        QDataStream stream{&file};
+        stream.setVersion(QDataStream::Version::Qt_6_0);
+        stream << GlyphMaskCache::magic << GlyphMaskCache::version << key << (quint32)glyphs.size() << qCompress(masks, 1);
+        if (!file.commit()) {
+            qCWarning(glyphMaskCache) << "Could not write mask cache file" << filePath << file.errorString();
+            return;
+        }
+
+        qCInfo(glyphMaskCache) << "Stored masks for" << build << targetSize << "in" << filePath;
+        prune(dir);
+    } catch (const std::exception& e) {
+        qCWarning(glyphMaskCache) << "Could not store the masks:" << e.what();
+    }
+}
+
+QDir GlyphMaskCache::cacheDir() {
+    QString cacheLocation{QStandardPaths::writableLocation(QStandardPaths::StandardLocation::CacheLocation)};
+    if (cacheLocation.isEmpty())
+        throw std::runtime_error("No cache location found!");
+
+    QDir dir{QDir{cacheLocation}.absoluteFilePath(QStringLiteral("glyph_masks"))};
+    createPathIfNeeded(dir);
+    return dir;
+}
+
+QString GlyphMaskCache::cacheFilePath(DeviceBuild build, const QSize& targetSize, const QByteArray& key) {
+    return cacheDir().absoluteFilePath(QStringLiteral("%1_%2x%3_%4.masks")
+        .arg(QString::fromLatin1(QMetaEnum::fromType<DeviceBuild>().valueToKey((int)build)))
+        .arg(targetSize.width())
+        .arg(targetSize.height())
+        .arg(QString::fromLatin1(key.toHex().left(16))));
+}
+
+void GlyphMaskCache::prune(const QDir& dir) {
+    QFileInfoList files{dir.entryInfoList({QStringLiteral("*.masks")}, QDir::Filter::Files, QDir::SortFlag::Time)}; // Newest first
+    for (qsizetype i{GlyphMaskCache::maxCacheFiles}; i < files.size(); ++i) {
+        qCInfo(glyphMaskCacheVerbose) << "Removing old mask cache file" << files.at(i).absoluteFilePath();
+        QFile::remove(files.at(i).absoluteFilePath());
+    }
+}
@@ -0,0 +1,76 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_GLYPHMASKCACHE_H
+#define GV_GLYPHMASKCACHE_H
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QList>
+#include <QMetaEnum>
+#include <QSaveFile>
+#include <QSize>
+#include <QStandardPaths>
+#include <QString>
+#include <QStringLiteral>
+
+#include "configurations/DeviceBuild.h"
+#include "Glyph.h"
+#include "Utils.h"
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(glyphMaskCache)
+Q_DECLARE_LOGGING_CATEGORY(glyphMaskCacheVerbose)
+
+using namespace DeviceBuildNS;
+
+// Keeps the rasterized glyph masks of a configuration on disk (one file per device build, target size and key),
+// so repeated exports and restarts at the same window size do not have to rasterize the SVGs again.
+// The key covers the SVG resources and the bounds of every glyph, so a changed glyph or layout never hits a stale entry.
+class GlyphMaskCache
+{
+public:
+    // Calculates the key for the current bounds of the glyphs (calcBounds must have been called).
+    // resourceHashes caches the hashes of the SVG files between the calls - the files do not change while running.
+    static QByteArray calcKey(const QList<Glyph>& glyphs, QHash<QString, QByteArray>& resourceHashes);
+
+    // Replaces the masks of all glyphs with the cached ones. Returns false if there is no valid cache entry.
+    static bool load(DeviceBuild build, const QSize& targetSize, const QByteArray& key, QList<Glyph>& glyphs);
+    static void store(DeviceBuild build, const QSize& targetSize, const QByteArray& key, const QList<Glyph>& glyphs);
+
+private:
+    static constexpr quint32 magic{0x47564d43}; // GVMC
+    // Increase whenever the mask rasterization or the file format changes
+    static constexpr quint32 version{1};
+    // The oldest files get removed once there are more
+    static constexpr qsizetype maxCacheFiles{32};
+
+    static QDir cacheDir();
+    static QString cacheFilePath(DeviceBuild build, const QSize& targetSize, const QByteArray& key);
+    static void prune(const QDir& dir);
+};
+
+#endif // GV_GLYPHMASKCACHE_H
@@ -0,0 +1,140 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "GlyphMatrix.h"
+
+GlyphMatrix::GlyphMatrix(int columns, int rows, const QRectF& firstCell, const QPointF& pitch)
+    : columns{columns}, rows{rows}, firstCell{firstCell}, pitch{pitch},
+      cellImage{columns, rows, QImage::Format::Format_ARGB32_Premultiplied}, columnStarts{}, rowStarts{}, maskPosition{}, maskSize{}, glyphBounds{}, mask{}
+{
+    if (columns <= 0 || rows <= 0 || pitch.x() <= 0 || pitch.y() <= 0)
+        throw std::logic_error("A GlyphMatrix needs at least one cell and a positive pitch!");
+}
+
+void GlyphMatrix::render(QPainter* painter, const Glyph& glyph, const QList<QColor>& colors, qsizetype firstZone) {
+    bool opaque{update(glyph, colors, firstZone)};
+
+    QPoint translation;
+    QImage* image{opaque ? Glyph::directTarget(painter, translation) : nullptr};
+    if (image != nullptr)
+        renderDirect(*image, this->maskPosition + translation, image->rect());
+    else
+        renderPainter(painter, this->maskPosition);
+}
+
+bool GlyphMatrix::update(const Glyph& glyph, const QList<QColor>& colors, qsizetype firstZone) {
+    if (firstZone < 0 || firstZone + cellCount() > colors.size())
+        throw std::logic_error("Not enough colors for the matrix! Got: " + std::to_string(colors.size()) + ", Expected: " + std::to_string(firstZone + cellCount()));
+
+    this->mask = glyph.getCoverageMask(); // Shallow copy
+    if (glyph.getMaskPosition() != this->maskPosition || this->mask.size() != this->maskSize || glyph.getScaledAlignedBounds() != this->glyphBounds)
+        updateGeometry(glyph);
+
+    // Write the colors into the cell image
+    bool opaque{true};
+    for (int row{0}; row < this->rows; ++row) {
+        QRgb* line{(QRgb*)this->cellImage.scanLine(row)};
+        for (int column{0}; column < this->columns; ++column) {
+            QRgb color{colors.at(firstZone + row * this->columns + column).rgba()};
+            opaque = opaque && qAlpha(color) == 255;
+            line[column] = qPremultiply(color);
+        }
+    }
+    return opaque;
+}
+
+void GlyphMatrix::renderCells(QImage& image, const QRect& clip) const {
+    renderDirect(image, this->maskPosition, clip);
+}
+
+QRect GlyphMatrix::cellRect(int cell) const {
+    int row{cell / this->columns};
+    int column{cell % this->columns};
+    return QRect{QPoint{this->columnStarts.at(column), this->rowStarts.at(row)},
+                 QPoint{this->columnStarts.at(column + 1) - 1, this->rowStarts.at(row + 1) - 1}}.translated(this->maskPosition);
+}
+
+void GlyphMatrix::updateGeometry(const Glyph& glyph) {
+    this->maskPosition = glyph.getMaskPosition();
+    this->maskSize = glyph.getCoverageMask().size();
+    this->glyphBounds = glyph.getScaledAlignedBounds();
+
+    QRectF svgBounds{glyph.getBounds()};
+    this->columnStarts = cellStarts(this->columns, this->firstCell.center().x(), this->pitch.x(), svgBounds.left(), this->glyphBounds.left(),
+                                    this->glyphBounds.width() / svgBounds.width(), this->maskPosition.x(), this->maskSize.width());
+    this->rowStarts = cellStarts(this->rows, this->firstCell.center().y(), this->pitch.y(), svgBounds.top(), this->glyphBounds.top(),
+                                 this->glyphBounds.height() / svgBounds.height(), this->maskPosition.y(), this->maskSize.height());
+}
+
+QList<int> GlyphMatrix::cellStarts(int cells, qreal firstCenter, qreal pitch, qreal svgOrigin, qreal targetOrigin, qreal scale, int maskOrigin, int maskLength) {
+    // The border between two cells lies halfway between their LEDs.
+    // A pixel belongs to the cell its center lies in, the outer cells extend to the edges of the mask.
+    QList<int> starts(cells + 1);
+    starts[0] = 0;
+    for (int cell{1}; cell < cells; ++cell) {
+        qreal border{targetOrigin + (firstCenter + (cell - 0.5) * pitch - svgOrigin) * scale - maskOrigin};
+        starts[cell] = qBound(starts[cell - 1], qCeil(border - 0.5), maskLength);
+    }
+    starts[cells] = maskLength;
+    return starts;
+}
+
+void GlyphMatrix::renderDirect(QImage& image, const QPoint& position, const QRect& clip) const {
+    // Clip to the image
+    QRect visible{QRect{position, this->mask.size()}.intersected(image.rect()).intersected(clip).translated(-position)};
+    if (visible.isEmpty())
+        return;
+
+    for (int row{0}; row < this->rows; ++row) {
+        const QRgb* cells{(const QRgb*)this->cellImage.constScanLine(row)};
+        int yEnd{qMin(this->rowStarts.at(row + 1), visible.bottom() + 1)};
+        for (int y{qMax(this->rowStarts.at(row), visible.top())}; y < yEnd; ++y) {
+            quint32* destination{(quint32*)image.scanLine(position.y() + y) + position.x()};
+            const quint8* coverage{this->mask.constScanLine(y)};
+            for (int column{0}; column < this->columns; ++column) {
+                int xStart{qMax(this->columnStarts.at(column), visible.left())};
+                int xEnd{qMin(this->columnStarts.at(column + 1), visible.right() + 1)};
+                if (xEnd > xStart)
+                    MaskCompositor::blendRow(destination + xStart, coverage + xStart, xEnd - xStart, cells[column]);
+            }
+        }
+    }
+}
+
+void GlyphMatrix::renderPainter(QPainter* painter, const QPoint& position) const {
+    // Build the colored mask and let the painter draw it
+    QImage coloredImage{this->mask.size(), QImage::Format::Format_ARGB32_Premultiplied};
+    for (int row{0}; row < this->rows; ++row) {
+        const QRgb* cells{(const QRgb*)this->cellImage.constScanLine(row)};
+        for (int y{this->rowStarts.at(row)}; y < this->rowStarts.at(row + 1); ++y) {
+            QRgb* destination{(QRgb*)coloredImage.scanLine(y)};
+            const quint8* coverage{this->mask.constScanLine(y)};
+            for (int column{0}; column < this->columns; ++column) {
+                QRgb color{cells[column]};
+                for (int x{this->columnStarts.at(column)}; x < this->columnStarts.at(column + 1); ++x) {
+                    int a{coverage[x]};
+                    destination[x] = qRgba((qRed(color) * a + 127) / 255, (qGreen(color) * a + 127) / 255,
+                                           (qBlue(color) * a + 127) / 255, (qAlpha(color) * a + 127) / 255);
+                }
+            }
+        }
+    }
+
+    painter->drawImage(position, coloredImage);
+}
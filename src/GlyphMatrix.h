@@ -0,0 +1,87 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_GLYPHMATRIX_H
+#define GV_GLYPHMATRIX_H
+
+#include <QColor>
+#include <QImage>
+#include <QList>
+#include <QPainter>
+#include <QPoint>
+#include <QPointF>
+#include <QRect>
+#include <QRectF>
+#include <QSize>
+#include <QtMath>
+
+#include "Glyph.h"
+#include "MaskCompositor.h"
+
+// Renders an LED matrix (e.g. the one of the Phone (3)) from a single glyph whose mask contains all LEDs.
+// The colors of the cells are written into a columns x rows image which is then stretched over the mask:
+// every pixel of the mask takes the color of the cell it lies in, so the cost only depends on the mask size
+// and not on the amount of LEDs. Cells without an LED have no coverage and stay invisible.
+class GlyphMatrix
+{
+public:
+    // firstCell is the LED of the top left cell and pitch the distance between two cells - both in svg units
+    GlyphMatrix(int columns, int rows, const QRectF& firstCell, const QPointF& pitch);
+
+    int cellCount() const { return this->columns * this->rows; }
+
+    // Colors the cells row by row with colors[firstZone] up to colors[firstZone + cellCount() - 1]
+    void render(QPainter* painter, const Glyph& glyph, const QList<QColor>& colors, qsizetype firstZone);
+
+    // The pieces of render() for callers that write the pixels themselves:
+    // update() takes over the geometry of the glyph and the cell colors - returns false if a color is not opaque.
+    bool update(const Glyph& glyph, const QList<QColor>& colors, qsizetype firstZone);
+    // Blends the cells from the last update() into image, but only inside of clip (image coordinates)
+    void renderCells(QImage& image, const QRect& clip) const;
+    // Pixels of a cell in image coordinates as of the last update()
+    QRect cellRect(int cell) const;
+
+private:
+    int columns;
+    int rows;
+    QRectF firstCell;
+    QPointF pitch;
+
+    // Premultiplied cell colors
+    QImage cellImage;
+
+    // Pixel ranges of the cells in mask coordinates - cell c covers [columnStarts[c], columnStarts[c + 1])
+    QList<int> columnStarts;
+    QList<int> rowStarts;
+    // Geometry the ranges were calculated for
+    QPoint maskPosition;
+    QSize maskSize;
+    QRectF glyphBounds;
+
+    void updateGeometry(const Glyph& glyph);
+    static QList<int> cellStarts(int cells, qreal firstCenter, qreal pitch, qreal svgOrigin, qreal targetOrigin, qreal scale, int maskOrigin, int maskLength);
+
+    // Coverage mask of the glyph from the last update()
+    QImage mask;
+
+    void renderDirect(QImage& image, const QPoint& position, const QRect& clip) const;
+    void renderPainter(QPainter* painter, const QPoint& position) const;
+};
+
+#endif // GV_GLYPHMATRIX_H
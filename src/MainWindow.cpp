@@ -24,7 +24,8 @@ Q_LOGGING_CATEGORY(mainWindow, "MainWindow")
 Q_LOGGING_CATEGORY(mainWindowVerbose, "MainWindow.Verbose")
 
 MainWindow::MainWindow(Config* config, QWidget *parent)
-    : QMainWindow(parent), config{config}, updateChecker{new UpdateChecker{this}}, firstShow{true}, configurationManager{}, compositonManager{this}
+    : QMainWindow(parent), config{config}, updateChecker{new UpdateChecker{this}}, firstShow{true}, configurationManager{}, compositonManager{this}, framePacer{this},
+    compositionLoadWatcher{new QFutureWatcher<ConfigurationManager::LoadedComposition>{this}}, loadingAudioPath{}, loadingReopensOpenCompositionDialog{false}
 {
     initUi();
 
@@ -38,7 +39,15 @@ MainWindow::MainWindow(Config* config, QWidget *parent)
 
     // Init composition manager
     connect(&this->compositonManager, &CompositionManager::compositionTick, this, &MainWindow::onCompositionManagerTick);
+    connect(&this->compositonManager, &CompositionManager::discontinuity, &this->framePacer, &FramePacer::discontinuity);
     connect(&this->compositonManager, &CompositionManager::mediaStatusChanged, this, &MainWindow::onCompositionManagerMediaStatusChanged);
+    connect(&this->framePacer, &FramePacer::renderFrame, this->glyphWidget, &GlyphWidget::render);
+    connect(this->glyphWidget, &GlyphWidget::framePainted, &this->framePacer, &FramePacer::framePainted);
+
+    // Init composition loading
+    connect(this->compositionLoadWatcher, &QFutureWatcherBase::progressValueChanged, this->loadingProgressBar, &QProgressBar::setValue);
+    connect(this->compositionLoadWatcher, &QFutureWatcherBase::resultReadyAt, this, &MainWindow::onCompositionLoadReady);
+    connect(this->compositionLoadWatcher, &QFutureWatcherBase::finished, this, &MainWindow::onCompositionLoadFinished);
 }
 
 MainWindow::~MainWindow() {
@@ -68,6 +77,9 @@ void MainWindow::showEvent(QShowEvent *event) {
     // Call the original showEvent
     QMainWindow::showEvent(event);
 
+    // Only the configuration of the initially displayed device has been constructed - the device of the last composition is likely next
+    this->configurationManager.warmUp((DeviceBuild)this->config->getInt(Config::Setting::LastDeviceBuild_Int));
+
     if (!this->config->getBool(Config::Setting::FirstStart_Bool)) {
         bool doNotShowAgain{this->config->getBool(Config::Setting::DonationDialog_DoNotShowAgain_Bool)};
         QDateTime lastShown{this->config->getQDateTime(Config::Setting::DonationDialog_LastShown_QDateTime)};
@@ -124,6 +136,8 @@ void MainWindow::dropEvent(QDropEvent* event) {
 }
 
 void MainWindow::initUi() {
+    StartupTrace::Scope scope{QStringLiteral("MainWindow::initUi")};
+
     // Window
     setObjectName(QStringLiteral("MainWindow"));
     resize(800, 600);
@@ -187,6 +201,12 @@ void MainWindow::initUi() {
     this->statusBar->setObjectName(QStringLiteral("StatusBar"));
     this->statusBar->setSizeGripEnabled(false);
     setStatusBar(this->statusBar);
+    this->loadingProgressBar = new QProgressBar(this->statusBar);
+    this->loadingProgressBar->setObjectName(QStringLiteral("LoadingProgressBar"));
+    this->loadingProgressBar->setRange(0, 100);
+    this->loadingProgressBar->setMaximumWidth(200);
+    this->loadingProgressBar->setVisible(false);
+    this->statusBar->addPermanentWidget(this->loadingProgressBar);
 
     // Central QWidget with vertical layout
     this->centralWidget = new QWidget(this);
@@ -211,25 +231,29 @@ void MainWindow::loadComposition(const std::pair<OpenCompositionMode, QList<QStr
     // Reset the UI before loading the new composition - if the loading fails we are still in a valid state
     onCompositionManagerMediaStatusChanged(QMediaPlayer::MediaStatus::NoMedia);
 
+    // The old composition is gone - and so is a composition that is still loading
+    this->compositonManager.stop();
+    this->configurationManager.cancelLoading();
+    setLoadingIndicatorVisible(false);
+
     qCInfo(mainWindowVerbose).nospace() << "Loading composition with openMode: " << compositionData.first
                                         << ", " << compositionData.second;
     try {
         DeviceBuild build;
         switch (compositionData.first) {
         case OpenCompositionMode::AUDIO_ONLY:
-            // Load the composition
-            build = configurationManager.loadCompositionFromAudio(compositionData.second.at(0));
-            this->glyphWidget->setConfiguration(configurationManager.getConfiguration(build));
-            this->compositonManager.loadAudio(compositionData.second.at(0));
-
-            // Play
-            this->compositonManager.play();
+            // Load the composition in the background - onCompositionLoadFinished continues from there
+            this->loadingAudioPath = compositionData.second.at(0);
+            this->loadingReopensOpenCompositionDialog = reopenOpenCompositionDialog;
+            this->compositionLoadWatcher->setFuture(this->configurationManager.loadCompositionFromAudioAsync(this->loadingAudioPath));
+            setLoadingIndicatorVisible(true);
             break;
         case OpenCompositionMode::AUDIO_AND_NGLYPH:
             // Load the composition
             build = configurationManager.loadCompositionFromNglyph(compositionData.second.at(1));
             this->glyphWidget->setConfiguration(configurationManager.getConfiguration(build));
-            this->compositonManager.loadAudio(compositionData.second.at(0));
+            this->config->setValue(Config::Setting::LastDeviceBuild_Int, (int)build);
+            this->compositonManager.loadAudio(QSharedPointer<const CompositionSource>::create(compositionData.second.at(0)));
 
             // Play
             this->compositonManager.play();
@@ -237,21 +261,74 @@ void MainWindow::loadComposition(const std::pair<OpenCompositionMode, QList<QStr
         }
     } catch (const SourceFileException& e) {
         qCWarning(mainWindow) << "SourceFileException:" << e.what();
+        showCompositionError(QStringLiteral("Composition file error"), e.what(), reopenOpenCompositionDialog);
+    } catch (const InvalidLightDataException& e) {
+        qCWarning(mainWindow) << "InvalidLightDataException:" << e.what();
+        showCompositionError(QStringLiteral("Composition light data error"), e.what(), reopenOpenCompositionDialog);
+    }
+}
+
+void MainWindow::onCompositionLoadReady() {
+    // The first seconds are parsed - the rest follows while playing
+    try {
+        ConfigurationManager::LoadedComposition composition{this->compositionLoadWatcher->future().resultAt(0)};
+        this->framePacer.resetStatistics(); // Logs the statistics of the last composition
+        this->glyphWidget->setConfiguration(this->configurationManager.applyComposition(composition));
+        this->config->setValue(Config::Setting::LastDeviceBuild_Int, (int)composition.build);
+        this->compositonManager.setFrames(composition.frames.get());
+        this->compositonManager.loadAudio(composition.source);
+
+        // Play
+        this->compositonManager.play();
+    } catch (const SourceFileException& e) {
+        qCWarning(mainWindow) << "SourceFileException:" << e.what();
+        this->configurationManager.cancelLoading();
+        showCompositionError(QStringLiteral("Composition file error"), e.what(), this->loadingReopensOpenCompositionDialog);
+    }
+}
+
+void MainWindow::onCompositionLoadFinished() {
+    setLoadingIndicatorVisible(false);
+
+    QFuture<ConfigurationManager::LoadedComposition> future{this->compositionLoadWatcher->future()};
+    try {
+        future.waitForFinished(); // Already finished - rethrows the exception of a failed load
+        if (future.isCanceled()) {
+            qCInfo(mainWindowVerbose) << "Loading of" << this->loadingAudioPath << "was canceled";
+            return;
+        }
 
-        QMessageBox* msg{new QMessageBox{QMessageBox::Icon::Critical, QStringLiteral("Composition file error"), QStringLiteral("Error loading the composition: %1").arg(e.what()), QMessageBox::StandardButton::Ok, this}};
-        if (reopenOpenCompositionDialog) connect(msg, &QDialog::finished, [&](){ this->openFileAction->trigger(); }); // Reopen the dialog
-        connect(msg, &QDialog::finished, msg, &QObject::deleteLater); // Delete the dialog after it is closed
-        msg->open();
+        // Only export complete compositions
+        this->exportAsVideoAction->setEnabled(this->compositonManagerControls->isEnabled());
+    } catch (const SourceFileException& e) {
+        qCWarning(mainWindow) << "SourceFileException:" << e.what();
+        showCompositionError(QStringLiteral("Composition file error"), e.what(), this->loadingReopensOpenCompositionDialog);
     } catch (const InvalidLightDataException& e) {
         qCWarning(mainWindow) << "InvalidLightDataException:" << e.what();
 
-        QMessageBox* msg{new QMessageBox{QMessageBox::Icon::Critical, QStringLiteral("Composition light data error"), QStringLiteral("Error loading the composition: %1").arg(e.what()), QMessageBox::StandardButton::Ok, this}};
-        if (reopenOpenCompositionDialog) connect(msg, &QDialog::finished, [&](){ this->openFileAction->trigger(); }); // Reopen the dialog
-        connect(msg, &QDialog::finished, msg, &QObject::deleteLater); // Delete the dialog after it is closed
-        msg->open();
+        // The error can be in a line after the playback already started
+        this->compositonManager.stop();
+        onCompositionManagerMediaStatusChanged(QMediaPlayer::MediaStatus::NoMedia);
+        showCompositionError(QStringLiteral("Composition light data error"), e.what(), this->loadingReopensOpenCompositionDialog);
     }
 }
 
+void MainWindow::setLoadingIndicatorVisible(bool visible) {
+    this->loadingProgressBar->setValue(0);
+    this->loadingProgressBar->setVisible(visible);
+    if (visible)
+        this->statusBar->showMessage(QStringLiteral("Loading %1...").arg(QFileInfo{this->loadingAudioPath}.fileName()));
+    else
+        this->statusBar->clearMessage();
+}
+
+void MainWindow::showCompositionError(const QString& title, const char* error, bool reopenOpenCompositionDialog) {
+    QMessageBox* msg{new QMessageBox{QMessageBox::Icon::Critical, title, QStringLiteral("Error loading the composition: %1").arg(error), QMessageBox::StandardButton::Ok, this}};
+    if (reopenOpenCompositionDialog) connect(msg, &QDialog::finished, [&](){ this->openFileAction->trigger(); }); // Reopen the dialog
+    connect(msg, &QDialog::finished, msg, &QObject::deleteLater); // Delete the dialog after it is closed
+    msg->open();
+}
+
 void MainWindow::onUpdateCheckerUpdateAvailable(const QString& newVersion) {
     QString newVersionMessage{
         QStringLiteral(
@@ -304,9 +381,9 @@ void MainWindow::onUpdateCheckerNoUpdateAvailable() {
     msg->open();
 }
 
-void MainWindow::onCompositionManagerTick(qint64 position) {
-    qint64 index{(qint64)(position / CompositionManager::tickIntervalMS)};
-    this->glyphWidget->render((qsizetype)index);
+void MainWindow::onCompositionManagerTick(qint64 tick) {
+    // One line of light data per tick - the pacer drops the frames that the widget could not paint in time
+    this->framePacer.requestFrame(tick);
 }
 
 void MainWindow::onCompositionManagerMediaStatusChanged(QMediaPlayer::MediaStatus status) {
@@ -328,9 +405,9 @@ void MainWindow::onCompositionManagerMediaStatusChanged(QMediaPlayer::MediaStatu
         this->glyphWidget->render(-1);
         break;
     case QMediaPlayer::MediaStatus::LoadedMedia:
-        // Enable controls
+        // Enable controls - exporting has to wait until the whole light data is parsed
         this->compositonManagerControls->setEnabled(true);
-        this->exportAsVideoAction->setEnabled(true);
+        this->exportAsVideoAction->setEnabled(!this->compositionLoadWatcher->isRunning());
         break;
     default:
         break;
@@ -352,8 +429,10 @@ void MainWindow::onExportAsVideoActionTriggered() {
     // Save the player state so we can restore it after closing the dialog
     this->compositionWasPlaying = this->compositonManager.isPlaying();
     this->compositonManager.pause();
+    // The export clones the configuration, which must not be rendered by the prefetcher at the same time
+    this->glyphWidget->stopPrefetching();
 
-    this->renderingSettingsDialog->open(this->compositonManager.audioPath(), this->configurationManager.getConfiguration(this->glyphWidget->getConfigurationDeviceBuild()));
+    this->renderingSettingsDialog->open(this->compositonManager.source(), this->configurationManager.getConfiguration(this->glyphWidget->getConfigurationDeviceBuild()));
 }
 void MainWindow::onCheckForUpdateActionTriggered() {
     qCInfo(mainWindowVerbose) << "Manual update check triggered";
@@ -388,8 +467,7 @@ void MainWindow::onAboutActionTriggered() {
             "GitHub: [*%5*](%6)\n"
             "***\n"
             "Libraries used:\n"
-            "- *Qt6* (%7)\n"
-            "- *TagLib* (%8.%9.%10)"
+            "- *Qt6* (%7)"
         )
         .arg(QCoreApplication::applicationName())
         .arg(QCoreApplication::applicationVersion())
@@ -398,7 +476,6 @@ void MainWindow::onAboutActionTriggered() {
         .arg(BUILDINFO_GITHUB_REPO_URL)
         .arg(BUILDINFO_GITHUB_REPO_URL)
         .arg(QT_VERSION_STR)
-        .arg(TAGLIB_MAJOR_VERSION).arg(TAGLIB_MINOR_VERSION).arg(TAGLIB_PATCH_VERSION)
     };
 
     QMessageBox* msg{new QMessageBox{QMessageBox::Icon::NoIcon, QStringLiteral("About %1").arg(QCoreApplication::applicationName()), aboutMessage, QMessageBox::StandardButton::Ok, this}};
@@ -27,6 +27,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <QDialog>
 #include <QDragEnterEvent>
 #include <QDropEvent>
+#include <QFileInfo>
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QHBoxLayout>
 #include <QKeySequence>
 #include <QMainWindow>
@@ -34,6 +37,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <QMenuBar>
 #include <QMessageBox>
 #include <QMimeData>
+#include <QProgressBar>
+#include <QSharedPointer>
 #include <QShowEvent>
 #include <QStatusBar>
 #include <QString>
@@ -51,8 +56,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "configurations/DeviceBuild.h"
 #include "Config.h"
 #include "DonationDialog.h"
+#include "FramePacer.h"
 #include "OpenCompositionDialog.h"
 #include "RenderingSettingsDialog.h"
+#include "StartupTrace.h"
 #include "UpdateChecker.h"
 #include "Utils.h"
 #include "widgets/CompositionManagerControls.h"
@@ -100,6 +107,7 @@ private:
     RenderingSettingsDialog* renderingSettingsDialog;
 
     QStatusBar* statusBar;
+    QProgressBar* loadingProgressBar;
     QWidget* centralWidget;
     QVBoxLayout* centralLayout;
     GlyphWidget* glyphWidget;
@@ -107,18 +115,29 @@ private:
 
     ConfigurationManager configurationManager;
     CompositionManager compositonManager;
+    FramePacer framePacer;
 
     bool compositionWasPlaying;
 
+    // The composition that is loaded in the background
+    QFutureWatcher<ConfigurationManager::LoadedComposition>* compositionLoadWatcher;
+    QString loadingAudioPath;
+    bool loadingReopensOpenCompositionDialog;
+
     void initUi();
     void loadComposition(const std::pair<OpenCompositionMode, QList<QString>>& compositionData, bool reopenOpenCompositionDialog);
+    void setLoadingIndicatorVisible(bool visible);
+    void showCompositionError(const QString& title, const char* error, bool reopenOpenCompositionDialog);
 
 private slots:
     void onUpdateCheckerUpdateAvailable(const QString& newVersion);
     void onUpdateCheckerUpdateCheckFailed(const QString& errorMessage);
     void onUpdateCheckerNoUpdateAvailable();
 
-    void onCompositionManagerTick(qint64 position);
+    void onCompositionLoadReady();
+    void onCompositionLoadFinished();
+
+    void onCompositionManagerTick(qint64 tick);
     void onCompositionManagerMediaStatusChanged(QMediaPlayer::MediaStatus status);
 
     void onOpenFileActionTriggered();
@@ -0,0 +1,190 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "MaskCompositor.h"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#   define GV_MASKCOMPOSITOR_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define GV_MASKCOMPOSITOR_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#   include <arm_neon.h>
+#   define GV_MASKCOMPOSITOR_NEON
+#endif
+
+namespace {
+    // (d * (255 - a) + c * a) / 255 rounded - exact for all 8 bit inputs and the same formula the vector paths use
+    inline quint32 lerpChannel(quint32 d, quint32 c, quint32 a) {
+        quint32 r{d * (255 - a) + c * a + 128};
+        return (r + (r >> 8)) >> 8;
+    }
+
+    inline quint32 lerpPixel(quint32 d, quint32 c, quint32 a) {
+        return lerpChannel(d & 0xff, c & 0xff, a)
+            | lerpChannel((d >> 8) & 0xff, (c >> 8) & 0xff, a) << 8
+            | lerpChannel((d >> 16) & 0xff, (c >> 16) & 0xff, a) << 16
+            | lerpChannel(d >> 24, c >> 24, a) << 24;
+    }
+
+    // Handles the remaining pixels that do not fill a whole vector
+    inline void blendRowScalar(quint32* destination, const quint8* coverage, qsizetype count, quint32 color) {
+        for (qsizetype i{0}; i < count; ++i) {
+            quint32 a{coverage[i]};
+            if (a == 0)
+                continue;
+            destination[i] = a == 255 ? color : lerpPixel(destination[i], color, a);
+        }
+    }
+
+#if defined(GV_MASKCOMPOSITOR_AVX2)
+    inline __m256i lerpEpi16(__m256i d, __m256i c, __m256i a, __m256i v255, __m256i v128) {
+        __m256i r{_mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(d, _mm256_sub_epi16(v255, a)), _mm256_mullo_epi16(c, a)), v128)};
+        return _mm256_srli_epi16(_mm256_add_epi16(r, _mm256_srli_epi16(r, 8)), 8);
+    }
+#elif defined(GV_MASKCOMPOSITOR_SSE2)
+    inline __m128i lerpEpi16(__m128i d, __m128i c, __m128i a, __m128i v255, __m128i v128) {
+        __m128i r{_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(d, _mm_sub_epi16(v255, a)), _mm_mullo_epi16(c, a)), v128)};
+        return _mm_srli_epi16(_mm_add_epi16(r, _mm_srli_epi16(r, 8)), 8);
+    }
+#endif
+}
+
+void MaskCompositor::blend(QImage& destination, const QPoint& position, const QImage& mask, QRgb color) {
+    blend(destination, position, mask, color, destination.rect());
+}
+
+void MaskCompositor::blend(QImage& destination, const QPoint& position, const QImage& mask, QRgb color, const QRect& clip) {
+    Q_ASSERT(destination.format() == QImage::Format::Format_RGB32 || destination.format() == QImage::Format::Format_ARGB32_Premultiplied);
+    Q_ASSERT(mask.format() == QImage::Format::Format_Alpha8);
+    Q_ASSERT(qAlpha(color) == 255);
+
+    QRect area{QRect{position, mask.size()}.intersected(destination.rect()).intersected(clip)};
+    if (area.isEmpty())
+        return;
+
+    // Only call bits() once - it checks for a detach every time
+    uchar* destinationBits{destination.bits()};
+    qsizetype destinationBytesPerLine{destination.bytesPerLine()};
+    const uchar* maskBits{mask.constBits()};
+    qsizetype maskBytesPerLine{mask.bytesPerLine()};
+
+    for (int y{area.top()}; y <= area.bottom(); ++y) {
+        quint32* destinationRow{(quint32*)(destinationBits + y * destinationBytesPerLine) + area.left()};
+        const quint8* coverageRow{maskBits + (y - position.y()) * maskBytesPerLine + (area.left() - position.x())};
+        MaskCompositor::blendRow(destinationRow, coverageRow, area.width(), color);
+    }
+}
+
+void MaskCompositor::blendRow(quint32* destination, const quint8* coverage, qsizetype count, quint32 color) {
+    qsizetype i{0};
+
+#if defined(GV_MASKCOMPOSITOR_AVX2)
+    // 8 pixels per iteration
+    const __m256i zero{_mm256_setzero_si256()};
+    const __m256i v255{_mm256_set1_epi16(255)};
+    const __m256i v128{_mm256_set1_epi16(128)};
+    const __m256i broadcast{_mm256_set1_epi32(0x01010101)};
+    const __m256i colorVector{_mm256_set1_epi32((int)color)};
+    const __m256i colorLow{_mm256_unpacklo_epi8(colorVector, zero)};
+    const __m256i colorHigh{_mm256_unpackhi_epi8(colorVector, zero)};
+    for (; i + 8 <= count; i += 8) {
+        quint64 coverage8;
+        std::memcpy(&coverage8, coverage + i, sizeof(coverage8));
+        if (coverage8 == 0)
+            continue; // Outside of the glyph - most common case
+        if (coverage8 == ~(quint64)0) {
+            _mm256_storeu_si256((__m256i*)(destination + i), colorVector);
+            continue;
+        }
+
+        // Spread every coverage byte to all 4 channels of its pixel
+        __m256i a{_mm256_mullo_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(coverage + i))), broadcast)};
+        __m256i d{_mm256_loadu_si256((const __m256i*)(destination + i))};
+
+        __m256i low{lerpEpi16(_mm256_unpacklo_epi8(d, zero), colorLow, _mm256_unpacklo_epi8(a, zero), v255, v128)};
+        __m256i high{lerpEpi16(_mm256_unpackhi_epi8(d, zero), colorHigh, _mm256_unpackhi_epi8(a, zero), v255, v128)};
+        _mm256_storeu_si256((__m256i*)(destination + i), _mm256_packus_epi16(low, high));
+    }
+#elif defined(GV_MASKCOMPOSITOR_SSE2)
+    // 4 pixels per iteration
+    const __m128i zero{_mm_setzero_si128()};
+    const __m128i v255{_mm_set1_epi16(255)};
+    const __m128i v128{_mm_set1_epi16(128)};
+    const __m128i colorVector{_mm_set1_epi32((int)color)};
+    const __m128i colorLow{_mm_unpacklo_epi8(colorVector, zero)};
+    const __m128i colorHigh{_mm_unpackhi_epi8(colorVector, zero)};
+    for (; i + 4 <= count; i += 4) {
+        quint32 coverage4;
+        std::memcpy(&coverage4, coverage + i, sizeof(coverage4));
+        if (coverage4 == 0)
+            continue; // Outside of the glyph - most common case
+        if (coverage4 == ~(quint32)0) {
+            _mm_storeu_si128((__m128i*)(destination + i), colorVector);
+            continue;
+        }
+
+        // Spread every coverage byte to all 4 channels of its pixel
+        __m128i a{_mm_cvtsi32_si128((int)coverage4)};
+        a = _mm_unpacklo_epi8(a, a);
+        a = _mm_unpacklo_epi16(a, a);
+        __m128i d{_mm_loadu_si128((const __m128i*)(destination + i))};
+
+        __m128i low{lerpEpi16(_mm_unpacklo_epi8(d, zero), colorLow, _mm_unpacklo_epi8(a, zero), v255, v128)};
+        __m128i high{lerpEpi16(_mm_unpackhi_epi8(d, zero), colorHigh, _mm_unpackhi_epi8(a, zero), v255, v128)};
+        _mm_storeu_si128((__m128i*)(destination + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(GV_MASKCOMPOSITOR_NEON)
+    // 8 pixels per iteration - vld4 splits the pixels into one vector per channel
+    const uint8x8x4_t colorChannels{{vdup_n_u8(color & 0xff), vdup_n_u8((color >> 8) & 0xff), vdup_n_u8((color >> 16) & 0xff), vdup_n_u8(color >> 24)}};
+    for (; i + 8 <= count; i += 8) {
+        quint64 coverage8;
+        std::memcpy(&coverage8, coverage + i, sizeof(coverage8));
+        if (coverage8 == 0)
+            continue; // Outside of the glyph - most common case
+
+        uint8x8_t a{vld1_u8(coverage + i)};
+        uint8x8_t inverseA{vmvn_u8(a)}; // 255 - a
+        uint8x8x4_t d{vld4_u8((const uint8_t*)(destination + i))};
+        for (int channel{0}; channel < 4; ++channel) {
+            uint16x8_t r{vaddq_u16(vmull_u8(d.val[channel], inverseA), vmull_u8(colorChannels.val[channel], a))};
+            r = vaddq_u16(r, vdupq_n_u16(128));
+            d.val[channel] = vshrn_n_u16(vaddq_u16(r, vshrq_n_u16(r, 8)), 8);
+        }
+        vst4_u8((uint8_t*)(destination + i), d);
+    }
+#endif
+
+    blendRowScalar(destination + i, coverage + i, count - i, color);
+}
+
+const char* MaskCompositor::instructionSet() {
+#if defined(GV_MASKCOMPOSITOR_AVX2)
+    return "AVX2";
+#elif defined(GV_MASKCOMPOSITOR_SSE2)
+    return "SSE2";
+#elif defined(GV_MASKCOMPOSITOR_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
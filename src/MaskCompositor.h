@@ -0,0 +1,48 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_MASKCOMPOSITOR_H
+#define GV_MASKCOMPOSITOR_H
+
+#include <QImage>
+#include <QPoint>
+#include <QRect>
+#include <QRgb>
+
+// Blends an opaque color into a 32 bit image through an 8 bit coverage mask: dst = lerp(dst, color, coverage).
+// The masks are rendered at the exact output resolution, so this is a plain per pixel blend without any scaling.
+// This is the hot loop of the glyph rendering - it is vectorized with AVX2, SSE2 or NEON depending on the target
+// (see the GLYPHVISUALIZER_AVX2 CMake option) and falls back to plain C++ otherwise.
+class MaskCompositor
+{
+public:
+    // destination must be Format_RGB32 or Format_ARGB32_Premultiplied, mask must be Format_Alpha8 and color must be opaque.
+    // The mask is placed with its top left corner at position and clipped to the destination.
+    static void blend(QImage& destination, const QPoint& position, const QImage& mask, QRgb color);
+    // Same as above but only touches the pixels inside of clip (destination coordinates)
+    static void blend(QImage& destination, const QPoint& position, const QImage& mask, QRgb color, const QRect& clip);
+
+    // Blends count pixels - the building block of blend()
+    static void blendRow(quint32* destination, const quint8* coverage, qsizetype count, quint32 color);
+
+    // Name of the compiled in instruction set (for logging)
+    static const char* instructionSet();
+};
+
+#endif // GV_MASKCOMPOSITOR_H
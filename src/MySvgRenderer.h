@@ -47,7 +47,13 @@ public:
     explicit MySvgRenderer(const QString& filename, const Reference& reference, const QPointF& referenceOffset, const QString& id = QString());
     MySvgRenderer(const MySvgRenderer& g);
 
+    QRectF getBounds() const { return this->bounds; }
     QRectF getScaledAlignedBounds() const { return this->scaledAlignedBounds; }
+    QString getFilename() const { return this->filename; }
+    QString getId() const { return this->id; }
+
+    // The renderers are QObjects - configurations constructed on pool threads hand them to the GUI thread
+    using QSvgRenderer::moveToThread;
 
     void render(QPainter* painter);
     virtual void calcBounds(const QRect& drawingArea, qreal scale);
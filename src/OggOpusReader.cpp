@@ -0,0 +1,237 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "OggOpusReader.h"
+
+#include <array>
+#include <cstring>
+
+// Logging
+Q_LOGGING_CATEGORY(oggOpusReader, "OggOpusReader")
+Q_LOGGING_CATEGORY(oggOpusReaderVerbose, "OggOpusReader.Verbose")
+
+OggOpusReader::OggOpusReader(const QString& filePath)
+    : filePath{filePath}, file{filePath}
+{}
+
+OggOpusReader::Probe OggOpusReader::probe() {
+    // The identification header is needed by both - only read it once
+    PageHeader firstPage{};
+    QByteArray head{readHead(firstPage)};
+
+    Probe probe{};
+    probe.tags = readTags(firstPage);
+    probe.streamInfo = readStreamInfo(head, firstPage);
+    return probe;
+}
+
+OggOpusReader::StreamInfo OggOpusReader::readStreamInfo(const QByteArray& head, const PageHeader& firstPage) {
+    StreamInfo info{};
+    info.channelCount = (quint8)head.at(9);
+    info.preSkip = qFromLittleEndian<quint16>(head.constData() + 10);
+    info.inputSampleRate = qFromLittleEndian<quint32>(head.constData() + 12);
+    info.lastGranulePosition = readLastGranulePosition(firstPage.serialNumber);
+
+    qCInfo(oggOpusReaderVerbose).nospace() << "Read stream info of " << this->filePath << ": channels=" << info.channelCount
+                                           << ", preSkip=" << info.preSkip << ", lastGranulePosition=" << info.lastGranulePosition
+                                           << ", duration=" << info.durationMS() << "ms";
+    return info;
+}
+
+OggOpusReader::Tags OggOpusReader::readTags(const PageHeader& firstPage) {
+    // The comment header starts on the second page and can span several pages (the light data is big).
+    // Only the segments up to the end of the packet are read.
+    Tags tags{};
+    qint64 offset{firstPage.size()};
+    bool packetComplete{false};
+    while (!packetComplete) {
+        PageHeader page{readPageHeader(offset)};
+        bool continued{(page.headerType & 0x01) != 0};
+        if (page.serialNumber != firstPage.serialNumber || continued == tags.packet.isEmpty())
+            throw SourceFileException("Malformed Ogg file '" + this->filePath.toStdString() + "'! Could not read the comment header.");
+
+        qint64 packetDataSize{0};
+        for (char lacingValue: page.segmentTable) {
+            packetDataSize += (quint8)lacingValue;
+            if ((quint8)lacingValue < 255) {
+                packetComplete = true;
+                break;
+            }
+        }
+
+        qsizetype packetSize{tags.packet.size()};
+        tags.packet.resize(packetSize + packetDataSize);
+        if (!this->file.seek(offset + OggOpusReader::pageHeaderSize + page.segmentTable.size())
+            || this->file.read(tags.packet.data() + packetSize, packetDataSize) != packetDataSize)
+            throw SourceFileException("Failed to read file '" + this->filePath.toStdString() + "'!");
+
+        offset += page.size();
+    }
+
+    // Vendor string and user comments - all lengths are 32 bit little endian (RFC 7845 section 5.2)
+    QByteArrayView packet{tags.packet};
+    qsizetype position{8};
+    auto readString{[this, &packet, &position]() {
+        if (position + 4 > packet.size())
+            throw SourceFileException("Malformed Ogg file '" + this->filePath.toStdString() + "'! The comment header is truncated.");
+        quint32 length{qFromLittleEndian<quint32>(packet.data() + position)};
+        position += 4;
+        if (length > (quint64)(packet.size() - position))
+            throw SourceFileException("Malformed Ogg file '" + this->filePath.toStdString() + "'! The comment header is truncated.");
+        QByteArrayView string{packet.sliced(position, length)};
+        position += length;
+        return string;
+    }};
+
+    if (!packet.startsWith("OpusTags"))
+        throw SourceFileException("Malformed Ogg file '" + this->filePath.toStdString() + "'! The comment header is missing.");
+    tags.vendor = readString();
+    if (position + 4 > packet.size())
+        throw SourceFileException("Malformed Ogg file '" + this->filePath.toStdString() + "'! The comment header is truncated.");
+    quint32 commentCount{qFromLittleEndian<quint32>(packet.data() + position)};
+    position += 4;
+    for (quint32 i{0}; i < commentCount; ++i)
+        tags.comments.append(readString());
+
+    qCInfo(oggOpusReaderVerbose).nospace() << "Read " << tags.comments.size() << " comments (" << tags.packet.size() << " bytes) of " << this->filePath;
+    return tags;
+}
+
+QList<QByteArrayView> OggOpusReader::Tags::values(QByteArrayView name) const {
+    QList<QByteArrayView> values;
+    for (QByteArrayView comment: this->comments) {
+        if (comment.size() > name.size() && comment.at(name.size()) == '=' && comment.first(name.size()).compare(name, Qt::CaseSensitivity::CaseInsensitive) == 0)
+            values.append(comment.sliced(name.size() + 1));
+    }
+    return values;
+}
+
+void OggOpusReader::open() {
+    if (this->file.isOpen())
+        return;
+
+    if (!this->file.open(QIODeviceBase::OpenModeFlag::ReadOnly))
+        throw SourceFileException("Failed to open file '" + this->filePath.toStdString() + "'!");
+}
+
+QByteArray OggOpusReader::readHead(PageHeader& firstPage) {
+    open();
+
+    // The first page must only contain the identification header (OpusHead)
+    firstPage = readPageHeader(0);
+    if (!(firstPage.headerType & 0x02)) // Beginning of stream
+        throw SourceFileException("Malformed Ogg file '" + this->filePath.toStdString() + "'! The first page is not the beginning of the stream.");
+    if (!this->file.seek(OggOpusReader::pageHeaderSize + firstPage.segmentTable.size()))
+        throw SourceFileException("Failed to read file '" + this->filePath.toStdString() + "'!");
+    QByteArray head{this->file.read(qMin(firstPage.dataSize, (qint64)19))};
+    if (head.size() < 19 || !head.startsWith("OpusHead"))
+        throw SourceFileException("Wrong audio codec! Only opus files with the .ogg extension are supported!");
+    return head;
+}
+
+bool OggOpusReader::parsePageHeader(const char* data, qsizetype size, PageHeader& header) const {
+    // Capture pattern and stream structure version
+    if (size < OggOpusReader::pageHeaderSize || std::memcmp(data, "OggS", 4) != 0 || data[4] != 0)
+        return false;
+
+    quint8 segmentCount{(quint8)data[26]};
+    if (size < OggOpusReader::pageHeaderSize + segmentCount)
+        return false;
+
+    header.headerType = (quint8)data[5];
+    header.granulePosition = qFromLittleEndian<qint64>(data + 6);
+    header.serialNumber = qFromLittleEndian<quint32>(data + 14);
+    header.sequenceNumber = qFromLittleEndian<quint32>(data + 18);
+    header.checksum = qFromLittleEndian<quint32>(data + 22);
+    header.segmentTable = QByteArray{data + OggOpusReader::pageHeaderSize, segmentCount};
+    header.dataSize = 0;
+    for (char lacingValue: header.segmentTable)
+        header.dataSize += (quint8)lacingValue;
+
+    return true;
+}
+
+OggOpusReader::PageHeader OggOpusReader::readPageHeader(qint64 offset) {
+    if (!this->file.seek(offset))
+        throw SourceFileException("Failed to read file '" + this->filePath.toStdString() + "'!");
+
+    QByteArray data{this->file.read(OggOpusReader::pageHeaderSize + 255)};
+    PageHeader header{};
+    if (!parsePageHeader(data.constData(), data.size(), header))
+        throw SourceFileException("Malformed Ogg file '" + this->filePath.toStdString() + "'!");
+    return header;
+}
+
+qint64 OggOpusReader::readLastGranulePosition(quint32 serialNumber) {
+    // Search backwards for the last complete page of our stream that finishes a packet (granule position != -1).
+    // Usually this is the very last page, so only the tail of the file has to be read.
+    qint64 fileSize{this->file.size()};
+    qint64 windowEnd{fileSize};
+    while (windowEnd > 0) {
+        qint64 windowStart{qMax((qint64)0, windowEnd - OggOpusReader::maxPageSize)};
+        qint64 readEnd{qMin(fileSize, windowEnd + OggOpusReader::maxPageSize)}; // Pages starting in the window may end after it
+        if (!this->file.seek(windowStart))
+            throw SourceFileException("Failed to read file '" + this->filePath.toStdString() + "'!");
+        QByteArray chunk{this->file.read(readEnd - windowStart)};
+
+        for (qsizetype i{(qsizetype)qMin((qint64)chunk.size(), windowEnd - windowStart) - 1}; i >= 0; --i) {
+            if (chunk.at(i) != 'O')
+                continue;
+
+            PageHeader header{};
+            if (!parsePageHeader(chunk.constData() + i, chunk.size() - i, header))
+                continue;
+            // The capture pattern can also appear inside of the audio data - only trust complete pages with a valid checksum
+            if (header.serialNumber != serialNumber || i + header.size() > chunk.size())
+                continue;
+            if (pageChecksum(chunk.constData() + i, header.size()) != header.checksum)
+                continue;
+            if (header.granulePosition == -1)
+                continue;
+
+            return header.granulePosition;
+        }
+
+        windowEnd = windowStart;
+    }
+
+    throw SourceFileException("Could not determine the length of '" + this->filePath.toStdString() + "'!");
+}
+
+quint32 OggOpusReader::pageChecksum(const char* page, qsizetype size) {
+    // CRC-32 with the polynomial 0x04c11db7 (no reflection, no final xor) - see RFC 3533
+    static const std::array<quint32, 256> table{[](){
+        std::array<quint32, 256> t{};
+        for (quint32 i{0}; i < 256; ++i) {
+            quint32 r{i << 24};
+            for (int j{0}; j < 8; ++j)
+                r = (r & 0x80000000) ? (r << 1) ^ 0x04c11db7 : (r << 1);
+            t[i] = r;
+        }
+        return t;
+    }()};
+
+    quint32 crc{0};
+    for (qsizetype i{0}; i < size; ++i) {
+        // The checksum field itself is calculated as zero
+        quint8 byte{(i >= 22 && i < 26) ? (quint8)0 : (quint8)page[i]};
+        crc = (crc << 8) ^ table[((crc >> 24) ^ byte) & 0xff];
+    }
+    return crc;
+}
@@ -0,0 +1,108 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_OGGOPUSREADER_H
+#define GV_OGGOPUSREADER_H
+
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QFile>
+#include <QList>
+#include <QString>
+#include <QtEndian>
+
+#include "Utils.h"
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(oggOpusReader)
+Q_DECLARE_LOGGING_CATEGORY(oggOpusReaderVerbose)
+
+// Minimal reader for Ogg Opus files (RFC 7845) that only touches the pages it needs.
+// The duration is taken from the granule position of the last page instead of decoding/scanning the whole file
+// and the tags are read from the comment header pages at the start of the file.
+class OggOpusReader
+{
+public:
+    // Opus granule positions always count 48 kHz samples - independent of the input sample rate
+    static constexpr qint64 granuleRate{48000};
+
+    struct StreamInfo {
+        quint8 channelCount{0};
+        quint16 preSkip{0};
+        quint32 inputSampleRate{0};
+        qint64 lastGranulePosition{0};
+
+        // Playable samples (48 kHz) - the pre-skip samples are decoded but discarded by the decoder
+        qint64 sampleCount() const { return qMax((qint64)0, this->lastGranulePosition - this->preSkip); }
+        qint64 durationMS() const { return sampleCount() * 1000 / OggOpusReader::granuleRate; }
+    };
+
+    // The comment header (OpusTags packet). The comments point into packet and are only valid as long as it is not modified.
+    struct Tags {
+        QByteArray packet;
+        QByteArrayView vendor;
+        QList<QByteArrayView> comments; // "NAME=value"
+
+        // The values of all comments with the field name (case insensitive)
+        QList<QByteArrayView> values(QByteArrayView name) const;
+    };
+
+    struct Probe {
+        StreamInfo streamInfo;
+        Tags tags;
+    };
+
+    explicit OggOpusReader(const QString& filePath);
+
+    // Reads the stream info and the tags in one pass over the file
+    Probe probe();
+
+private:
+    static constexpr qint64 pageHeaderSize{27};
+    static constexpr qint64 maxPageSize{pageHeaderSize + 255 + 255 * 255};
+
+    struct PageHeader {
+        quint8 headerType{0};
+        qint64 granulePosition{0};
+        quint32 serialNumber{0};
+        quint32 sequenceNumber{0};
+        quint32 checksum{0};
+        QByteArray segmentTable;
+        qint64 dataSize{0};
+
+        qint64 size() const { return OggOpusReader::pageHeaderSize + this->segmentTable.size() + this->dataSize; }
+    };
+
+    QString filePath;
+    QFile file;
+
+    void open();
+    // Reads the identification header (OpusHead) - also checks that this is an opus stream
+    QByteArray readHead(PageHeader& firstPage);
+    StreamInfo readStreamInfo(const QByteArray& head, const PageHeader& firstPage);
+    Tags readTags(const PageHeader& firstPage);
+    bool parsePageHeader(const char* data, qsizetype size, PageHeader& header) const;
+    PageHeader readPageHeader(qint64 offset);
+    qint64 readLastGranulePosition(quint32 serialNumber);
+
+    static quint32 pageChecksum(const char* page, qsizetype size);
+};
+
+#endif // GV_OGGOPUSREADER_H
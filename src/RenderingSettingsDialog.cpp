@@ -36,18 +36,19 @@ RenderingSettingsDialog::RenderingSettingsDialog(QWidget* parent)
     connect(this->renderer, &CompositionRenderer::renderingFinished, this, &RenderingSettingsDialog::onRendererFinished);
     connect(this->renderer, &CompositionRenderer::ffmpegErrorOccurred, this, &RenderingSettingsDialog::onRendererFFmpegError);
     connect(this->renderer, &CompositionRenderer::unexpectedErrorOccurred, this, &RenderingSettingsDialog::onRendererUnexpectedError);
+    connect(this->renderer, &CompositionRenderer::statisticsChanged, this, &RenderingSettingsDialog::onRendererStatisticsChanged);
 }
 RenderingSettingsDialog::~RenderingSettingsDialog() {
     delete this->progressDialog;
 }
 
-void RenderingSettingsDialog::open(const QString& audioPath, IConfiguration* config) {
+void RenderingSettingsDialog::open(QSharedPointer<const CompositionSource> source, IConfiguration* config) {
     // Save values
-    this->audioPath = audioPath;
+    this->source = source;
     this->config = config;
 
-    // Determine the output file name from the file name of the audioPath
-    QString outputFilePath{QFileInfo{this->audioPath}.baseName().append(QStringLiteral(".mp4"))};
+    // Determine the output file name from the file name of the audio
+    QString outputFilePath{QFileInfo{this->source->audioPath()}.baseName().append(QStringLiteral(".mp4"))};
 
     // Determine output path
     QStringList movieLocations{QStandardPaths::standardLocations(QStandardPaths::StandardLocation::MoviesLocation)};
@@ -113,6 +114,21 @@ void RenderingSettingsDialog::initUi() {
     this->resolutionDropdown->setCurrentIndex(2); // Select 1080p per default
     formLayout->addRow(QStringLiteral("Resolution:"), this->resolutionDropdown);
 
+    // Add frame rate dropdown - the light data has 60 lines per second and is resampled for the other frame rates
+    this->frameRateDropdown = new QComboBox{};
+    for (int frameRate: {24, 30, 50, 60, 120})
+        this->frameRateDropdown->addItem(QStringLiteral("%1 fps").arg(frameRate), frameRate);
+    this->frameRateDropdown->setCurrentIndex(3); // Select 60 fps per default - one frame per line of light data
+    formLayout->addRow(QStringLiteral("Frame rate:"), this->frameRateDropdown);
+
+    // Add resampling dropdown
+    this->resamplingDropdown = new QComboBox{};
+    this->resamplingDropdown->addItem(QStringLiteral("Nearest (sharp)"), (int)CompositionRenderer::FrameResampling::Nearest);
+    this->resamplingDropdown->addItem(QStringLiteral("Blend (LED persistence)"), (int)CompositionRenderer::FrameResampling::Blend);
+    formLayout->addRow(QStringLiteral("Resampling:"), this->resamplingDropdown);
+    connect(this->frameRateDropdown, &QComboBox::currentIndexChanged, this, &RenderingSettingsDialog::updateResamplingUI);
+    updateResamplingUI();
+
     // Add background color picker
     QGridLayout* backgroundColorRow{new QGridLayout{}};
     this->backgroundColorButton = new QToolButton{};
@@ -135,6 +151,10 @@ void RenderingSettingsDialog::initUi() {
     connect(this->ffmpegPathAutoDetectButton, &QPushButton::clicked, this, &RenderingSettingsDialog::onFFmpegPathAutoDetectButton);
     connect(this->ffmpegPathBrowseButton, &QPushButton::clicked, this, &RenderingSettingsDialog::onFFmpegPathBrowseButtonClicked);
 
+    // Add performance trace checkbox
+    this->traceCheckBox = new QCheckBox{QStringLiteral("Write a performance trace (.trace.json) next to the video")};
+    formLayout->addRow(QStringLiteral("Profiling:"), this->traceCheckBox);
+
     // Add spacing before the dialog buttons
     this->layout->addSpacing(5);
     // Dialog buttons
@@ -161,6 +181,11 @@ void RenderingSettingsDialog::updatebackgroundColorUI(const QColor& color) {
     this->backgroundColorLabel->setText(color.name());
 }
 
+void RenderingSettingsDialog::updateResamplingUI() {
+    // Nothing to resample at the native rate of the light data
+    this->resamplingDropdown->setEnabled(this->frameRateDropdown->currentData().toInt() != Timeline::ticksPerSecond);
+}
+
 void RenderingSettingsDialog::afterRenderCleanup() {
     // This function must only be called after the rendering is finished/crashed/etc.
     // because only then is progressDialog guaranteed to be valid.
@@ -227,6 +252,8 @@ void RenderingSettingsDialog::onButtonBoxAccepted() {
     QSize resolution{this->resolutionDropdown->currentData().toSize()};
     QColor backgroundColor{this->backgroundColorLabel->text()};
     QString ffmpegPath{this->ffmpegPathLineEdit->text().trimmed()};
+    int frameRate{this->frameRateDropdown->currentData().toInt()};
+    CompositionRenderer::FrameResampling resampling{(CompositionRenderer::FrameResampling)this->resamplingDropdown->currentData().toInt()};
 
     // Do checks on the values
     if (filePath.isEmpty() || ffmpegPath.isEmpty()) {
@@ -270,7 +297,8 @@ void RenderingSettingsDialog::onButtonBoxAccepted() {
 
     try {
         // Start render - no need to catch anything (except for missing audio file) because we confirmed the validity above
-        this->renderer->render(this->audioPath, this->config, filePath, resolution, backgroundColor, ffmpegPath);
+        this->renderer->setTraceFilePath(this->traceCheckBox->isChecked() ? filePath + QStringLiteral(".trace.json") : QString{});
+        this->renderer->render(this->source, this->config, filePath, resolution, backgroundColor, ffmpegPath, frameRate, resampling);
     } catch (const SourceFileException& e) {
         QMessageBox* msg{new QMessageBox{QMessageBox::Icon::Warning, QStringLiteral("Starting Render Failed"), QStringLiteral("Starting the renderer failed for the following reason:\n%1\n\nTry reopening the composition and try again.").arg(e.what()), QMessageBox::StandardButton::Ok, this}};
         connect(msg, &QDialog::finished, msg, &QObject::deleteLater); // Delete the dialog after it is closed
@@ -285,7 +313,7 @@ void RenderingSettingsDialog::onButtonBoxAccepted() {
 void RenderingSettingsDialog::onRendererAborted() {
     afterRenderCleanup();
 
-    QMessageBox* msg{new QMessageBox{QMessageBox::Icon::Information, QStringLiteral("Rendering Aborted"), QStringLiteral("Rendering aborted successfully!"), QMessageBox::StandardButton::Ok, this}};
+    QMessageBox* msg{new QMessageBox{QMessageBox::Icon::Information, QStringLiteral("Rendering Aborted"), QStringLiteral("Rendering aborted successfully!\n\nAlready rendered parts were kept. Rendering the same composition to the same file again resumes where it left off."), QMessageBox::StandardButton::Ok, this}};
     connect(msg, &QDialog::finished, msg, &QObject::deleteLater); // Delete the dialog after it is closed
     msg->open();
 }
@@ -296,6 +324,20 @@ void RenderingSettingsDialog::onRendererFinished() {
     connect(msg, &QDialog::finished, msg, &QObject::deleteLater); // Delete the dialog after it is closed
     msg->open();
 }
+void RenderingSettingsDialog::onRendererStatisticsChanged(const RenderStatistics& statistics) {
+    if (!this->progressDialog)
+        return;
+
+    QString ffmpegSpeed{statistics.ffmpegSpeed < 0 ? QStringLiteral("-") : QStringLiteral("%1x").arg(statistics.ffmpegSpeed, 0, 'f', 2)};
+    this->progressDialog->setLabelText(
+        QStringLiteral("Rendering... %1 fps\nPaint: %2 ms, Handoff: %3 ms, Write stall: %4 ms, FFmpeg speed: %5")
+            .arg(statistics.framesPerSecond, 0, 'f', 1)
+            .arg(statistics.paintMS, 0, 'f', 2)
+            .arg(statistics.handoffMS, 0, 'f', 2)
+            .arg(statistics.writeStallMS, 0, 'f', 2)
+            .arg(ffmpegSpeed)
+    );
+}
 void RenderingSettingsDialog::onRendererFFmpegError(const QString& error) {
     afterRenderCleanup();
 
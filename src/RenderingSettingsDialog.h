@@ -21,6 +21,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define GV_RENDERINGSETTINGSDIALOG_H
 
 #include <QApplication>
+#include <QCheckBox>
 #include <QColor>
 #include <QColorDialog>
 #include <QComboBox>
@@ -35,6 +36,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <QMessageBox>
 #include <QProgressDialog>
 #include <QPushButton>
+#include <QSharedPointer>
 #include <QShowEvent>
 #include <QSize>
 #include <QStandardPaths>
@@ -46,6 +48,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <QWidget>
 
 #include "CompositionRenderer.h"
+#include "CompositionSource.h"
 #include "configurations/IConfiguration.h"
 #include "Utils.h"
 
@@ -63,7 +66,7 @@ public:
 
 public slots:
     void open() override { throw std::logic_error("RenderingSettingsDialog: Please use the correct open function!"); };
-    void open(const QString& audioPath, IConfiguration* config);
+    void open(QSharedPointer<const CompositionSource> source, IConfiguration* config);
 
 protected:
     virtual void showEvent(QShowEvent* event) override;
@@ -75,6 +78,8 @@ private:
     QPushButton* filePathBrowseButton;
 
     QComboBox* resolutionDropdown;
+    QComboBox* frameRateDropdown;
+    QComboBox* resamplingDropdown;
 
     QToolButton* backgroundColorButton;
     QLabel* backgroundColorLabel;
@@ -83,9 +88,11 @@ private:
     QPushButton* ffmpegPathAutoDetectButton;
     QPushButton* ffmpegPathBrowseButton;
 
+    QCheckBox* traceCheckBox;
+
     QDialogButtonBox* buttonBox;
 
-    QString audioPath;
+    QSharedPointer<const CompositionSource> source;
     IConfiguration* config;
 
     QProgressDialog* progressDialog;
@@ -93,6 +100,7 @@ private:
 
     void initUi();
     void updatebackgroundColorUI(const QColor& color);
+    void updateResamplingUI();
     void afterRenderCleanup();
 
 private slots:
@@ -104,6 +112,7 @@ private slots:
 
     void onRendererAborted();
     void onRendererFinished();
+    void onRendererStatisticsChanged(const RenderStatistics& statistics);
     void onRendererFFmpegError(const QString& error);
     void onRendererUnexpectedError(const QString& error);
 };
@@ -0,0 +1,81 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "StartupTrace.h"
+
+// Logging
+Q_LOGGING_CATEGORY(startupTrace, "StartupTrace")
+Q_LOGGING_CATEGORY(startupTraceVerbose, "StartupTrace.Verbose")
+
+std::atomic_bool StartupTrace::recording{true};
+QString StartupTrace::filePath{};
+bool StartupTrace::exitAfterStartup{false};
+
+StartupTrace::Scope::Scope(const QString& name)
+    : name{name}, startNS{StartupTrace::elapsedNS()}
+{}
+
+StartupTrace::Scope::~Scope() {
+    StartupTrace::addCompleteEvent(this->name, this->startNS);
+}
+
+TraceWriter& StartupTrace::writer() {
+    static TraceWriter writer{};
+    return writer;
+}
+
+qint64 StartupTrace::elapsedNS() {
+    return writer().elapsedNS();
+}
+
+void StartupTrace::addCompleteEvent(const QString& name, qint64 startNS) {
+    if (!StartupTrace::recording)
+        return;
+
+    qint64 endNS{elapsedNS()};
+    writer().addCompleteEvent(name, startNS, endNS - startNS);
+    qCInfo(startupTraceVerbose).nospace() << name << " took " << (endNS - startNS) / 1000000.0 << "ms";
+}
+
+void StartupTrace::setOutput(const QString& filePath, bool exitAfterStartup) {
+    StartupTrace::filePath = filePath;
+    StartupTrace::exitAfterStartup = exitAfterStartup;
+}
+
+void StartupTrace::firstPaint() {
+    // Only the first call counts
+    if (!StartupTrace::recording.exchange(false))
+        return;
+
+    qint64 timestampNS{elapsedNS()};
+    writer().addInstantEvent(QStringLiteral("First GlyphWidget paint"), timestampNS);
+    qCInfo(startupTrace).nospace() << "First frame painted " << timestampNS / 1000000.0 << "ms after start";
+
+    // Do not write the file from inside of a paint event
+    QMetaObject::invokeMethod(QCoreApplication::instance(), &StartupTrace::finish, Qt::ConnectionType::QueuedConnection);
+}
+
+void StartupTrace::finish() {
+    if (StartupTrace::filePath.isEmpty())
+        return;
+
+    bool success{writer().write(StartupTrace::filePath)};
+    if (StartupTrace::exitAfterStartup)
+        QCoreApplication::exit(success ? 0 : 1);
+}
@@ -0,0 +1,70 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_STARTUPTRACE_H
+#define GV_STARTUPTRACE_H
+
+#include <QCoreApplication>
+#include <QMetaObject>
+#include <QString>
+
+#include <atomic>
+
+#include "TraceWriter.h"
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(startupTrace)
+Q_DECLARE_LOGGING_CATEGORY(startupTraceVerbose)
+
+// Records the milestones of the application start until the first frame of the GlyphWidget was painted.
+// Recording is always active (it is only a handful of events) but the trace is only written if a file was set
+// with the '--startup-trace' command line option. Timestamps are relative to the first call into this class.
+class StartupTrace
+{
+public:
+    // Records the time from its construction until it goes out of scope as one event
+    class Scope
+    {
+    public:
+        explicit Scope(const QString& name);
+        ~Scope();
+
+    private:
+        QString name;
+        qint64 startNS;
+    };
+
+    static qint64 elapsedNS();
+    static void addCompleteEvent(const QString& name, qint64 startNS);
+
+    static void setOutput(const QString& filePath, bool exitAfterStartup);
+    // Ends the recording - writes the trace (if requested) once the event loop is free again
+    static void firstPaint();
+
+private:
+    static TraceWriter& writer();
+    static std::atomic_bool recording;
+    static QString filePath;
+    static bool exitAfterStartup;
+
+    static void finish();
+};
+
+#endif // GV_STARTUPTRACE_H
@@ -0,0 +1,55 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_TIMELINE_H
+#define GV_TIMELINE_H
+
+#include <QtGlobal>
+
+// The light data timeline. One tick (= one line of light data = one video frame) is exactly 1/60 s.
+// All conversions are done with integers, so tick indexes are exact no matter how long the composition is.
+// Converting a tick to a time returns the first (rounded up) time that lies inside that tick,
+// so tickFromMS(tickToMS(tick)) == tick always holds.
+class Timeline
+{
+public:
+    static constexpr qint64 ticksPerSecond{60};
+
+    static constexpr qint64 tickFromMS(qint64 positionMS) { return floorDiv(positionMS * Timeline::ticksPerSecond, 1000); }
+    static constexpr qint64 tickFromNS(qint64 positionNS) { return floorDiv(positionNS * Timeline::ticksPerSecond, 1000000000); }
+    static constexpr qint64 tickToMS(qint64 tick) { return ceilDiv(tick * 1000, Timeline::ticksPerSecond); }
+    static constexpr qint64 tickToNS(qint64 tick) { return ceilDiv(tick * 1000000000, Timeline::ticksPerSecond); }
+
+    // Number of frames needed to cover the given amount of samples (the last partial frame counts as a whole one)
+    static constexpr qint64 frameCount(qint64 sampleCount, qint64 sampleRate, qint64 frameRate) { return ceilDiv(sampleCount * frameRate, sampleRate); }
+    static constexpr qint64 tickCount(qint64 sampleCount, qint64 sampleRate) { return frameCount(sampleCount, sampleRate, Timeline::ticksPerSecond); }
+
+private:
+    static constexpr qint64 floorDiv(qint64 a, qint64 b) { return a / b - ((a % b != 0) && ((a < 0) != (b < 0))); }
+    static constexpr qint64 ceilDiv(qint64 a, qint64 b) { return -floorDiv(-a, b); }
+};
+
+static_assert(Timeline::tickFromMS(16) == 0 && Timeline::tickFromMS(17) == 1 && Timeline::tickFromMS(1000) == 60);
+static_assert(Timeline::tickToMS(1) == 17 && Timeline::tickToMS(3) == 50 && Timeline::tickToNS(1) == 16666667);
+static_assert(Timeline::tickFromNS(Timeline::tickToNS(1) - 1) == 0 && Timeline::tickFromNS(Timeline::tickToNS(1)) == 1);
+// 10 hours worth of ticks
+static_assert(Timeline::tickFromMS(Timeline::tickToMS(2160000 - 1)) == 2160000 - 1);
+static_assert(Timeline::tickCount(48000, 48000) == 60 && Timeline::tickCount(48001, 48000) == 61);
+
+#endif // GV_TIMELINE_H
@@ -0,0 +1,109 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "TraceWriter.h"
+
+// Logging
+Q_LOGGING_CATEGORY(traceWriter, "TraceWriter")
+Q_LOGGING_CATEGORY(traceWriterVerbose, "TraceWriter.Verbose")
+
+TraceWriter::TraceWriter()
+    : mutex{}, timer{}, events{}
+{
+    this->timer.start();
+}
+
+void TraceWriter::clear() {
+    QMutexLocker locker{&this->mutex};
+    this->events.clear();
+    this->timer.start();
+}
+
+void TraceWriter::addCompleteEvent(const QString& name, qint64 startNS, qint64 durationNS) {
+    addEvent(Event{name, 'X', startNS, durationNS, 0, QThread::currentThreadId()});
+}
+void TraceWriter::addInstantEvent(const QString& name, qint64 timestampNS) {
+    addEvent(Event{name, 'i', timestampNS, 0, 0, QThread::currentThreadId()});
+}
+void TraceWriter::addCounterEvent(const QString& name, qint64 timestampNS, qreal value) {
+    addEvent(Event{name, 'C', timestampNS, 0, value, QThread::currentThreadId()});
+}
+
+void TraceWriter::addEvent(Event&& event) {
+    QMutexLocker locker{&this->mutex};
+    this->events.append(std::move(event));
+}
+
+bool TraceWriter::write(const QString& filePath) const {
+    QMutexLocker locker{&this->mutex};
+    qCInfo(traceWriter) << "Writing" << this->events.size() << "trace events to" << filePath;
+
+    QSaveFile file{filePath};
+    if (!file.open(QIODeviceBase::OpenModeFlag::WriteOnly)) {
+        qCWarning(traceWriter) << "Could not open trace file" << filePath << file.errorString();
+        return false;
+    }
+
+    // The trace can contain hundreds of thousands of events - write them by hand instead of building a QJsonDocument
+    // Chrome wants small integer thread ids, so we number the threads in the order they appear
+    QHash<Qt::HANDLE, int> threadIds;
+    qint64 pid{QCoreApplication::applicationPid()};
+    QByteArray buffer;
+    buffer.reserve(1 << 16);
+    buffer.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (qsizetype i{0}; i < this->events.size(); ++i) {
+        const Event& event{this->events.at(i)};
+        int tid{threadIds.value(event.threadId, (int)threadIds.size() + 1)};
+        threadIds.insert(event.threadId, tid);
+
+        QByteArray name{event.name.toUtf8()};
+        name.replace('\\', "\\\\").replace('"', "\\\"");
+
+        buffer.append("{\"name\":\"").append(name)
+            .append("\",\"ph\":\"").append(event.phase)
+            .append("\",\"pid\":").append(QByteArray::number(pid))
+            .append(",\"tid\":").append(QByteArray::number(tid))
+            .append(",\"ts\":").append(QByteArray::number(event.timestampNS / 1000.0, 'f', 3));
+        switch (event.phase) {
+        case 'X':
+            buffer.append(",\"dur\":").append(QByteArray::number(event.durationNS / 1000.0, 'f', 3));
+            break;
+        case 'i':
+            buffer.append(",\"s\":\"t\"");
+            break;
+        case 'C':
+            buffer.append(",\"args\":{\"value\":").append(QByteArray::number(event.value)).append('}');
+            break;
+        }
+        buffer.append(i + 1 < this->events.size() ? "},\n" : "}\n");
+
+        if (buffer.size() > (1 << 16)) {
+            file.write(buffer);
+            buffer.clear();
+        }
+    }
+    buffer.append("]}\n");
+    file.write(buffer);
+
+    if (!file.commit()) {
+        qCWarning(traceWriter) << "Could not write trace file" << filePath << file.errorString();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,73 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_TRACEWRITER_H
+#define GV_TRACEWRITER_H
+
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QString>
+#include <QThread>
+
+// Logging
+#include <QLoggingCategory>
+Q_DECLARE_LOGGING_CATEGORY(traceWriter)
+Q_DECLARE_LOGGING_CATEGORY(traceWriterVerbose)
+
+// Collects timing events and writes them in the Chrome trace event format
+// (viewable with chrome://tracing or https://ui.perfetto.dev).
+// All timestamps are nanoseconds relative to the start of the writer (see elapsedNS).
+class TraceWriter
+{
+public:
+    TraceWriter();
+
+    qint64 elapsedNS() const { return this->timer.nsecsElapsed(); }
+
+    void clear();
+    void addCompleteEvent(const QString& name, qint64 startNS, qint64 durationNS);
+    void addInstantEvent(const QString& name, qint64 timestampNS);
+    void addCounterEvent(const QString& name, qint64 timestampNS, qreal value);
+
+    bool write(const QString& filePath) const;
+
+private:
+    struct Event {
+        QString name;
+        char phase;
+        qint64 timestampNS;
+        qint64 durationNS;
+        qreal value;
+        Qt::HANDLE threadId;
+    };
+
+    mutable QMutex mutex;
+    QElapsedTimer timer;
+    QList<Event> events;
+
+    void addEvent(Event&& event);
+};
+
+#endif // GV_TRACEWRITER_H
@@ -29,54 +29,100 @@ const QRegularExpression ConfigurationManager::composerExpression(QStringLiteral
 ConfigurationManager::ConfigurationManager()
     : QObject{}
 {
+    StartupTrace::Scope scope{QStringLiteral("ConfigurationManager construction")};
     QColor offColor = brightnessToGlyphColor(0);
-    configurations[Phone1Configuration::staticBuild] = QSharedPointer<Phone1Configuration>::create(offColor);
-    configurations[Phone2Configuration::staticBuild] = QSharedPointer<Phone2Configuration>::create(offColor);
-    configurations[Phone2aConfiguration::staticBuild] = QSharedPointer<Phone2aConfiguration>::create(offColor);
-    configurations[Phone3aConfiguration::staticBuild] = QSharedPointer<Phone3aConfiguration>::create(offColor);
-    configurations[Phone3Configuration::staticBuild] = QSharedPointer<Phone3Configuration>::create(offColor);
+    for (DeviceBuild build: DeviceLayout::builds()) {
+        const DeviceLayout* layout{DeviceLayout::find(build)};
+        factories[build] = [layout, offColor](){ return QSharedPointer<DeviceConfiguration>::create(*layout, offColor); };
+        constructionMutexes[build] = QSharedPointer<QMutex>::create();
+    }
+}
+
+ConfigurationManager::~ConfigurationManager() {
+    // The warm-up writes into our map and the load uses our configurations - let them finish before we are gone
+    this->loadFuture.cancel();
+    this->loadFuture.waitForFinished();
+    this->warmUpFuture.waitForFinished();
 }
 
 IConfiguration* ConfigurationManager::getConfiguration(DeviceBuild device) {
-    if (!this->configurations.contains(device)) {
+    if (!this->factories.contains(device)) {
         qCCritical(configurationManager) << "Requested invalid DeviceBuild:" << device;
         throw std::logic_error("Requested invalid DeviceBuild!");
     }
 
-    return this->configurations.value(device).get();
+    // Holding the lock of the device while constructing makes a request for a configuration that is currently being
+    // warmed up wait for it instead of constructing it a second time
+    QMutexLocker constructionLocker{this->constructionMutexes.value(device).get()};
+    {
+        QMutexLocker locker{&this->configurationsMutex};
+        QSharedPointer<IConfiguration> configuration{this->configurations.value(device)};
+        if (!configuration.isNull())
+            return configuration.get();
+    }
+
+    QString deviceName{QMetaEnum::fromType<DeviceBuild>().valueToKey((int)device)};
+    StartupTrace::Scope scope{QStringLiteral("ConfigurationManager: construct %1").arg(deviceName)};
+    QElapsedTimer timer;
+    timer.start();
+    QSharedPointer<IConfiguration> configuration{this->factories.value(device)()};
+    // The warm-up and the loading construct on pool threads that can go away - the GUI thread paints the configurations
+    if (QThread::currentThread() != QCoreApplication::instance()->thread())
+        configuration->moveRenderersToThread(QCoreApplication::instance()->thread());
+    qCInfo(configurationManagerVerbose) << "Constructed configuration for" << device << "in" << timer.elapsed() << "ms";
+
+    QMutexLocker locker{&this->configurationsMutex};
+    this->configurations.insert(device, configuration);
+    return configuration.get();
 }
 
-DeviceBuild ConfigurationManager::loadCompositionFromAudio(const QString& audioPath) {
-    qCInfo(configurationManager) << "Loading composition from audio...";
+void ConfigurationManager::warmUp(DeviceBuild device) {
+    if (this->warmUpFuture.isValid() || !this->factories.contains(device))
+        return;
 
-    // Make sure the file exists
-    QFileInfo fileInfo{audioPath};
-    if (!fileInfo.isFile()) {
-        throw SourceFileException("The audio file '" + audioPath.toStdString() + "' could not be found!");
-    }
-    if (fileInfo.suffix() != QStringLiteral("ogg")) {
-        throw SourceFileException("Wrong file extension! Only opus files with the .ogg extension are supported!");
-    }
+    this->warmUpFuture = QtConcurrent::run([this, device](){
+        getConfiguration(device);
+        qCInfo(configurationManagerVerbose) << "Warm-up of" << device << "finished";
+    });
+}
 
-    // Read the audio tags with TagLib
-    // TagLib also makes sure that the codec is opus
-    TagLib::FileRef f{audioPath.toStdString().c_str()};
-    if (f.isNull()) {
-        throw SourceFileException("Failed to open file '" + audioPath.toStdString() + "'!");
-    }
-    TagLib::PropertyMap tags;
-    if (auto file = dynamic_cast<TagLib::Ogg::Opus::File *>(f.file())) {
-        tags = file->properties();
-    } else {
-        throw SourceFileException("Wrong audio codec! Only opus files with the .ogg extension are supported!");
-    }
-    if (!tags.contains("AUTHOR") || tags["AUTHOR"].size() != 1)
+QFuture<ConfigurationManager::LoadedComposition> ConfigurationManager::loadCompositionFromAudioAsync(const QString& audioPath) {
+    // Only one composition can be shown - nobody waits for the result of the running load anymore
+    cancelLoading();
+
+    this->loadFuture = QtConcurrent::run([this, audioPath](QPromise<LoadedComposition>& promise) {
+        promise.setProgressRange(0, 100);
+        try {
+            readCompositionFromAudio(audioPath, promise);
+        } catch (...) {
+            // QtConcurrent would wrap the exception in a QUnhandledException - keep the original type for the caller
+            promise.setException(std::current_exception());
+        }
+    });
+    return this->loadFuture;
+}
+
+IConfiguration* ConfigurationManager::applyComposition(const LoadedComposition& composition) {
+    IConfiguration* config{getConfiguration(composition.build)};
+    config->frames = composition.frames;
+
+    qCInfo(configurationManager) << "Showing composition with" << composition.frames->frameCount() << "frames parsed so far";
+    return config;
+}
+
+void ConfigurationManager::readCompositionFromAudio(const QString& audioPath, QPromise<LoadedComposition>& promise) {
+    qCInfo(configurationManager) << "Loading composition from audio...";
+    QElapsedTimer timer;
+    timer.start();
+
+    // Probe the file once - the player and the exporter reuse the result
+    QSharedPointer<CompositionSource> source{QSharedPointer<CompositionSource>::create(audioPath)};
+    QByteArray author{source->takeLightData()};
+    if (author.isNull())
         throw InvalidLightDataException("Malformed light data! Could not extract the 'AUTHOR' tag.");
-    QByteArray author{tags.value("AUTHOR").front().to8Bit().c_str()};
-    //qCInfo(configurationManagerVerbose) << "Author raw:" << author;
-    if (!tags.contains("COMPOSER") || tags["COMPOSER"].size() != 1)
+    const QString& composer{source->composer()};
+    if (composer.isNull())
         throw InvalidLightDataException("Malformed light data! Could not extract the 'COMPOSER' tag.");
-    QString composer{tags.value("COMPOSER").front().to8Bit().c_str()};
     qCInfo(configurationManagerVerbose) << "Composer:" << composer;
 
     // Get DeviceBuild from the composer string
@@ -104,95 +150,148 @@ DeviceBuild ConfigurationManager::loadCompositionFromAudio(const QString& audioP
         build = DeviceBuild::Pacman;
 
     qCInfo(configurationManagerVerbose) << "Parsed device build:" << build;
+    promise.setProgressValue(10);
+    if (promise.isCanceled())
+        return;
 
     // Base64 decode
-    QByteArray::FromBase64Result authorBase64Result{QByteArray::fromBase64Encoding(author)};
+    // The light data is ours alone - decode it in place instead of copying it
+    QByteArray::FromBase64Result authorBase64Result{QByteArray::fromBase64Encoding(std::move(author))};
     if (authorBase64Result.decodingStatus != QByteArray::Base64DecodingStatus::Ok)
         throw InvalidLightDataException("Malformed light data! Could not decode data.");
-    author = authorBase64Result.decoded;
+    author = std::move(authorBase64Result.decoded);
     //qCInfo(configurationManagerVerbose) << "Author decoded:" << author;
 
     // Decompress
     // Prepend the 4 byte header indicating the expected size (we use 200k bytes = 0x030D40) and uncompress the data
     // See here: https://doc.qt.io/qt-6/qbytearray.html#qUncompress
-    author.prepend(QByteArray::fromHex("00030D40"));
+    // The header goes into the space in front of the data that was freed when cutting the value out
+    author.prepend("\x00\x03\x0D\x40", 4);
     QString decodedAuthor{qUncompress(author)};
     if (decodedAuthor.trimmed().isEmpty())
         throw InvalidLightDataException("Malformed light data! Could not uncompress data.\nAre you sure that you selected the right entry in the dropdown?");
     //qCInfo(configurationManagerVerbose) << "Author csv:" << decodedAuthor;
-
-    // Parse the data
-    QList<QList<int>> lightData{parseLightData(decodedAuthor)};
+    promise.setProgressValue(20);
+    if (promise.isCanceled())
+        return;
+
+    // Parse the data in chunks of lines - a wave of chunks is parsed in parallel on the global thread pool, then the
+    // chunks are checked and appended in order. The frames are published as soon as there are enough to start playing,
+    // the rest is parsed while the composition is already shown.
+    const QList<QStringView> chunks{splitLightData(decodedAuthor)};
+    const qsizetype waveSize{qMax(1, QThreadPool::globalInstance()->maxThreadCount())};
+    IConfiguration* config{getConfiguration(build)};
+    QSharedPointer<FrameStore> frames;
+    bool published{false};
+    for (qsizetype wave{0}; wave < chunks.size(); wave += waveSize) {
+        if (promise.isCanceled())
+            return;
+        promise.setProgressValue(20 + (int)(80 * wave / chunks.size()));
+
+        // Results are in the order of the chunks
+        QList<ParsedLightData> parsedChunks{QtConcurrent::blockingMapped(chunks.mid(wave, waveSize), &ConfigurationManager::parseLightData)};
+        for (const ParsedLightData& parsedChunk: parsedChunks) {
+            appendLightData(parsedChunk.rows, build, config, frames);
+
+            // The lines before an invalid one were checked above - so this is the first error in the file
+            if (!parsedChunk.invalidLine.isNull())
+                throw InvalidLightDataException("Malformed light data! Could not convert to integers: '" + parsedChunk.invalidLine.toStdString() + "'");
+        }
+
+        // Enough to start playing
+        if (!published && !frames.isNull() && frames->hasLead(0))
+            published = promise.addResult(LoadedComposition{source, build, frames});
+    }
     // We still need to check here bc. a non empty decodedAuthor string can still result
     // in an empty list e.g.: '\n'
-    if (lightData.empty())
+    if (frames.isNull())
         throw InvalidLightDataException("Malformed light data! No valid light values (empty).");
+
+    frames->finish();
+    if (!published)
+        promise.addResult(LoadedComposition{source, build, frames});
+    promise.setProgressValue(100);
+
+    qCInfo(configurationManager) << "Loaded composition successfully!";
+    qCInfo(configurationManagerVerbose) << "Read composition with" << frames->frameCount() << "lines in" << chunks.size() << "chunks in" << timer.elapsed() << "ms";
+}
+
+void ConfigurationManager::appendLightData(const QList<QList<int>>& lightData, DeviceBuild build, const IConfiguration* config, QSharedPointer<FrameStore>& frames) {
+    if (lightData.isEmpty())
+        return;
     // qCInfo(configurationManagerVerbose) << "Parsed light data:" << lightData;
 
     // Check if the number of columns are consistent and valid
-    IConfiguration* config{getConfiguration(build)};
-    qsizetype firstSize{lightData.first().size()};
-    if (!config->supportedZones.contains(firstSize))
-        throw InvalidLightDataException(
-            std::string("The amount of zones does not match the amount of supported zones (")
-                .append(QMetaEnum::fromType<DeviceBuild>().valueToKey((int)build))
-                .append("). Got: ").append(std::to_string(firstSize))
-                .append(", Expected: ").append(listToString(config->supportedZones).toStdString())
-        );
+    if (frames.isNull()) {
+        qsizetype firstSize{lightData.first().size()};
+        if (!config->supportedZones.contains(firstSize))
+            throw InvalidLightDataException(
+                std::string("The amount of zones does not match the amount of supported zones (")
+                    .append(QMetaEnum::fromType<DeviceBuild>().valueToKey((int)build))
+                    .append("). Got: ").append(std::to_string(firstSize))
+                    .append(", Expected: ").append(listToString(config->supportedZones).toStdString())
+            );
+
+        frames = QSharedPointer<FrameStore>::create(firstSize, glyphPalette());
+        // The GUI thread holds on to the store and may be the one that deletes it
+        frames->moveToThread(QCoreApplication::instance()->thread());
+    }
     for (const QList<int>& row: lightData) {
-        if (row.size() != firstSize)
+        if (row.size() != frames->zoneCount())
             throw InvalidLightDataException(
                 std::string("At least one line has a different length than the others. Got: ")
                     .append(std::to_string(row.size()))
-                    .append(", Expected: ").append(std::to_string(firstSize))
+                    .append(", Expected: ").append(std::to_string(frames->zoneCount()))
             );
     }
 
-    // Convert the ints to QColors we can use to color in the Glyphs
-    QList<QList<QColor>> colors;
-    colors.reserve(lightData.size());
-    for (const QList<int>& row: lightData) {
-        QList<QColor> colorRow;
-        colorRow.reserve(row.size());
-        std::transform(row.cbegin(), row.cend(), std::back_inserter(colorRow), [](const int& v){
-            return ConfigurationManager::brightnessToGlyphColor(v);
-        });
-        colors.append(colorRow);
-    }
-    // qCInfo(configurationManagerVerbose) << "Color data:" << colors;
-
-    // Set the colors
-    config->parsedColors = colors;
-
-    qCInfo(configurationManager) << "Loaded composition successfully!";
-
-    return build;
+    // The store maps the values to the colors we can use to color in the Glyphs (see glyphPalette)
+    frames->append(lightData);
 }
 DeviceBuild ConfigurationManager::loadCompositionFromNglyph(const QString& nglyphPath) {
     // TODO: Implement loadCompositionFromNglyph
     throw SourceFileException("NOT IMPLEMENTED YET!");
 }
 
-QList<QList<int>> ConfigurationManager::parseLightData(const QString& lightData) {
-    QList<QList<int>> data;
+QList<QStringView> ConfigurationManager::splitLightData(QStringView lightData) {
+    // Only cut after a line break, so every chunk contains complete lines
+    QList<QStringView> chunks;
+    qsizetype chunkStart{0};
+    while (chunkStart < lightData.size()) {
+        qsizetype chunkEnd{chunkStart};
+        for (qsizetype line{0}; line < ConfigurationManager::chunkLineCount && chunkEnd < lightData.size(); ++line) {
+            qsizetype lineBreak{lightData.indexOf(u'\n', chunkEnd)};
+            chunkEnd = lineBreak < 0 ? lightData.size() : lineBreak + 1;
+        }
+        chunks.append(lightData.sliced(chunkStart, chunkEnd - chunkStart));
+        chunkStart = chunkEnd;
+    }
+    return chunks;
+}
+
+ConfigurationManager::ParsedLightData ConfigurationManager::parseLightData(QStringView lightData) {
+    ParsedLightData data;
 
-    const QList<QString> lightDataList{QString{lightData}.replace(QString{"\r\n"}, QString{"\n"}).split("\n")};
+    for (QStringView line: lightData.split(u'\n')) {
+        // The line as it is in the file for the error message (\r\n line breaks)
+        if (line.endsWith(u'\r'))
+            line.chop(1);
 
-    for (const QString& line: lightDataList) {
         // Remove whitespace and trailing comma
-        QString trimmedLine{line.trimmed()};
-        if (trimmedLine.endsWith(','))
-            trimmedLine.removeLast();
+        QStringView trimmedLine{line.trimmed()};
+        if (trimmedLine.endsWith(u','))
+            trimmedLine.chop(1);
 
         // Skip empty lines
         if (trimmedLine.isEmpty())
             continue;
 
         // Split lines and map to ints
-        QList<QString> split{trimmedLine.split(',', Qt::SplitBehaviorFlags::SkipEmptyParts)};
+        QList<QStringView> split{trimmedLine.split(u',', Qt::SplitBehaviorFlags::SkipEmptyParts)};
         QList<int> rowData;
+        rowData.reserve(split.size());
         bool ok = true;
-        std::transform(split.cbegin(), split.cend(), std::back_inserter(rowData), [&ok](const QString& s){
+        std::transform(split.cbegin(), split.cend(), std::back_inserter(rowData), [&ok](QStringView s){
             bool lOk = false;
             int i{s.toInt(&lOk)};
 
@@ -207,16 +306,30 @@ QList<QList<int>> ConfigurationManager::parseLightData(const QString& lightData)
             return i;
         });
 
-        // Catch conversion error
-        if (!ok)
-            throw InvalidLightDataException("Malformed light data! Could not convert to integers: '" + line.toStdString() + "'");
+        // Catch conversion error - the lines before still have to be checked by the caller
+        if (!ok) {
+            data.invalidLine = line.toString();
+            break;
+        }
 
-        data.append(rowData);
+        data.rows.append(rowData);
     }
 
     return data;
 }
 
+const QList<QColor>& ConfigurationManager::glyphPalette() {
+    // brightnessToGlyphColor clamps anything outside of [0, maxLightValue], just like the FrameStore does with its palette
+    static const QList<QColor> palette{[](){
+        QList<QColor> colors;
+        colors.reserve(ConfigurationManager::maxLightValue + 1);
+        for (int value{0}; value <= ConfigurationManager::maxLightValue; ++value)
+            colors.append(ConfigurationManager::brightnessToGlyphColor(value));
+        return colors;
+    }()};
+    return palette;
+}
+
 QColor ConfigurationManager::brightnessToGlyphColor(int value) {
     // Clamp the value and calculate percentage (0-1)
     qreal percentage = std::max(0., std::min(1., ((qreal)value) / ConfigurationManager::maxLightValue));
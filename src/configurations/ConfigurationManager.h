@@ -21,32 +21,41 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define GV_CONFIGURATIONMANAGER_H
 
 #include <QByteArray>
+#include <QByteArrayView>
 #include <QColor>
 #include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
+#include <QFuture>
 #include <QList>
 #include <QMap>
 #include <QMetaEnum>
 #include <QList>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QObject>
+#include <QPromise>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QSharedPointer>
 #include <QString>
+#include <QStringView>
 #include <QStringLiteral>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrentMap>
+#include <QtConcurrentRun>
 
-#include <fileref.h>
-#include <toolkit/tpropertymap.h>
-#include <ogg/opus/opusfile.h>
+#include <functional>
 
+#include "../CompositionSource.h"
 #include "DeviceBuild.h"
+#include "DeviceConfiguration.h"
+#include "DeviceLayout.h"
+#include "../FrameStore.h"
 #include "IConfiguration.h"
-#include "Phone1Configuration.h"
-#include "Phone2aConfiguration.h"
-#include "Phone2Configuration.h"
-#include "Phone3aConfiguration.h"
-#include "Phone3Configuration.h"
+#include "../StartupTrace.h"
 #include "../Utils.h"
 
 // Logging
@@ -64,18 +73,58 @@ public:
     static constexpr qreal glyphOffHSVValue = 0.285;
 
     ConfigurationManager();
+    ~ConfigurationManager();
 
+    // Configurations are only constructed on the first request for their device (parsing the SVGs is expensive)
     IConfiguration* getConfiguration(DeviceBuild device);
-
-    DeviceBuild loadCompositionFromAudio(const QString& audioPath);
+    // Constructs the configuration of device on a background thread so that showing it later does not stall
+    void warmUp(DeviceBuild device);
+
+    // A composition that is being parsed - the frames are only handed to the configuration by applyComposition
+    struct LoadedComposition {
+        QSharedPointer<const CompositionSource> source; // The probed audio file - for the player and the exporter
+        DeviceBuild build{};
+        QSharedPointer<FrameStore> frames;
+    };
+
+    // Reads and parses the composition on the global thread pool and reports the progress from 0 to 100.
+    // The result is ready as soon as the frames have enough of a lead to start playing - the parsing continues
+    // until the future finishes. Starting another load cancels the running one.
+    // Errors are reported as SourceFileException or InvalidLightDataException (also after the result is ready).
+    QFuture<LoadedComposition> loadCompositionFromAudioAsync(const QString& audioPath);
+    void cancelLoading() { this->loadFuture.cancel(); }
+    // Hands the colors to the configuration of the composition - the configuration must not be rendered at the same time
+    IConfiguration* applyComposition(const LoadedComposition& composition);
     DeviceBuild loadCompositionFromNglyph(const QString& nglyphPath);
 
     static QColor brightnessToGlyphColor(int value);
 private:
+    QMap<DeviceBuild, std::function<QSharedPointer<IConfiguration>()>> factories;
     QMap<DeviceBuild, QSharedPointer<IConfiguration>> configurations;
+    // Only guards the map - constructing a configuration holds the mutex of its device, so a request only waits for its own device
+    QMutex configurationsMutex;
+    QMap<DeviceBuild, QSharedPointer<QMutex>> constructionMutexes; // Not changed after the construction of the manager
+    QFuture<void> warmUpFuture;
+    QFuture<LoadedComposition> loadFuture;
     static const QRegularExpression composerExpression;
-
-    static QList<QList<int>> parseLightData(const QString& lightData);
+    // Lines that are parsed in one chunk
+    static constexpr qsizetype chunkLineCount{1024};
+
+    // The lines of a chunk of the light data up to the first line that is not made of integers
+    struct ParsedLightData {
+        QList<QList<int>> rows;
+        QString invalidLine; // Null if all lines are valid
+    };
+
+    void readCompositionFromAudio(const QString& audioPath, QPromise<LoadedComposition>& promise);
+    // Checks the rows and appends them to frames - the first rows create the store
+    static void appendLightData(const QList<QList<int>>& lightData, DeviceBuild build, const IConfiguration* config, QSharedPointer<FrameStore>& frames);
+    // Splits the light data into chunks of chunkLineCount lines
+    static QList<QStringView> splitLightData(QStringView lightData);
+    // Parses a chunk of lines - empty lines are skipped. Safe to run on several chunks in parallel.
+    static ParsedLightData parseLightData(QStringView lightData);
+    // The colors of all light values - index = value
+    static const QList<QColor>& glyphPalette();
 };
 
 #endif // GV_CONFIGURATIONMANAGER_H
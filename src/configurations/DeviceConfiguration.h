@@ -0,0 +1,207 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_DEVICECONFIGURATION_H
+#define GV_DEVICECONFIGURATION_H
+
+#include <QImage>
+#include <QRect>
+#include <QString>
+
+#include <cstring>
+#include <optional>
+
+#include "DeviceLayout.h"
+#include "IConfiguration.h"
+#include "../GlyphMatrix.h"
+#include "../Utils.h"
+
+// Configuration of any device that is described by a DeviceLayout (see resources/layouts)
+class DeviceConfiguration : public IConfiguration {
+public:
+    DeviceConfiguration(const DeviceLayout& layout, const QColor& fallbackColor): IConfiguration{
+        fallbackColor,
+        createGlyphs(layout),
+        layout.build,
+        supportedZonesOf(layout),
+        QSize{layout.width, layout.height},
+        createElements<MySvgRenderer>(layout.decorations, layout.decorationCount)
+    }, layout{&layout}, matrix{}
+    {
+        if (layout.matrix != nullptr) {
+            const MatrixLayout& m{*layout.matrix};
+            this->matrix.emplace(m.columns, m.rows, QRectF{m.cellX, m.cellY, m.cellWidth, m.cellHeight}, QPointF{m.pitchX, m.pitchY});
+        }
+    }
+
+    virtual void calcBounds(const QRect& drawingArea, qreal scale) override {
+        for (MySvgRenderer& s: this->decorations)
+            s.calcBounds(drawingArea, scale);
+
+        // Glyphs can only be aligned to earlier glyphs, so their bounds are always ready
+        for (qsizetype i = 0; i < this->layout->glyphCount; ++i) {
+            qint16 alignAbove{this->layout->glyphs[i].alignAbove};
+            if (alignAbove < 0) {
+                this->glyphs[i].calcBounds(drawingArea, scale);
+                continue;
+            }
+
+            // Modify the drawing area so the glyph gets aligned to the top of the other glyph
+            QRect tmpDrawingArea{drawingArea};
+            tmpDrawingArea.setBottom(this->glyphs[alignAbove].getScaledAlignedBounds().top());
+            this->glyphs[i].calcBounds(tmpDrawingArea, scale);
+        }
+
+        if (this->matrix)
+            matrixGlyph().calcBounds(drawingArea, scale);
+    }
+
+    virtual IConfiguration* clone() const override {
+        return new DeviceConfiguration{*this};
+    }
+
+    virtual bool renderChanges(QImage& image, const QImage& base, const QList<QColor>& colors, const QList<QColor>& previousColors) override {
+        // The glyphs get blended straight into the pixels, which only works the same as renderPrivate for opaque colors
+        if (image.size() != base.size() || image.format() != base.format() || colors.size() != previousColors.size())
+            return false;
+        if (image.format() != QImage::Format::Format_RGB32 && image.format() != QImage::Format::Format_ARGB32_Premultiplied)
+            return false;
+        for (const QColor& color: colors) {
+            if (color.alpha() != 255)
+                return false;
+        }
+
+        const ZoneMapping& mapping{zoneMappingFor(colors.size())};
+
+        // Collect the areas of everything that changed
+        QList<QRect> dirtyAreas;
+        const quint16* offsets{mapping.zoneGlyphOffsets};
+        for (qsizetype zone = 0; zone < mapping.zoneCount; ++zone) {
+            if (colors.at(zone) == previousColors.at(zone))
+                continue;
+            for (quint16 i = offsets[zone]; i < offsets[zone + 1]; ++i)
+                dirtyAreas.append(maskRect(this->glyphs.at(mapping.zoneGlyphs[i])));
+        }
+        if (this->matrix && mapping.matrixZone >= 0) {
+            this->matrix->update(matrixGlyph(), colors, mapping.matrixZone);
+
+            // Hundreds of small cells - one area around all changed ones is cheaper than redrawing each of them
+            QRect changedCells;
+            for (int cell = 0; cell < this->matrix->cellCount(); ++cell) {
+                qsizetype zone{mapping.matrixZone + cell};
+                QRect cellRect{this->matrix->cellRect(cell)};
+                if (colors.at(zone) != previousColors.at(zone) && !cellRect.isEmpty())
+                    changedCells |= cellRect;
+            }
+            if (!changedCells.isEmpty())
+                dirtyAreas.append(changedCells);
+        }
+
+        for (const QRect& area: dirtyAreas)
+            redrawArea(image, base, area.intersected(image.rect()), colors, mapping);
+        return true;
+    }
+
+protected:
+    virtual void renderPrivate(QPainter& painter, const QList<QColor>& colors) override {
+        const ZoneMapping& mapping{zoneMappingFor(colors.size())};
+
+        // Render the decorations first because we always want to see the glyphs
+        renderDecorations(painter);
+
+        // Walk the zones and fan each color out to its glyphs - no per glyph lookups and unused zones cost nothing
+        const quint16* offsets{mapping.zoneGlyphOffsets};
+        for (qsizetype zone = 0; zone < mapping.zoneCount; ++zone) {
+            const QColor& color{colors.at(zone)};
+            for (quint16 i = offsets[zone]; i < offsets[zone + 1]; ++i)
+                this->glyphs[mapping.zoneGlyphs[i]].renderColored(&painter, color);
+        }
+
+        if (this->matrix && mapping.matrixZone >= 0)
+            this->matrix->render(&painter, matrixGlyph(), colors, mapping.matrixZone);
+    }
+
+private:
+    const DeviceLayout* layout;
+    std::optional<GlyphMatrix> matrix;
+
+    // The matrix is rendered from one glyph that is placed after the regular ones - this way its mask is cached like any other
+    Glyph& matrixGlyph() { return this->glyphs.last(); }
+
+    static QRect maskRect(const Glyph& glyph) { return QRect{glyph.getMaskPosition(), glyph.getCoverageMask().size()}; }
+
+    // Restores the pixels of the area from base and blends everything that touches it again in the order of renderPrivate
+    void redrawArea(QImage& image, const QImage& base, const QRect& area, const QList<QColor>& colors, const ZoneMapping& mapping) {
+        if (area.isEmpty())
+            return;
+
+        qsizetype bytesPerPixel{image.depth() / 8};
+        for (int y = area.top(); y <= area.bottom(); ++y)
+            std::memcpy(image.scanLine(y) + area.left() * bytesPerPixel, base.constScanLine(y) + area.left() * bytesPerPixel, area.width() * bytesPerPixel);
+
+        const quint16* offsets{mapping.zoneGlyphOffsets};
+        for (qsizetype zone = 0; zone < mapping.zoneCount; ++zone) {
+            QRgb color{colors.at(zone).rgba()};
+            for (quint16 i = offsets[zone]; i < offsets[zone + 1]; ++i) {
+                const Glyph& glyph{this->glyphs.at(mapping.zoneGlyphs[i])};
+                if (maskRect(glyph).intersects(area))
+                    MaskCompositor::blend(image, glyph.getMaskPosition(), glyph.getCoverageMask(), color, area);
+            }
+        }
+
+        if (this->matrix && mapping.matrixZone >= 0)
+            this->matrix->renderCells(image, area);
+    }
+
+    static QList<Glyph> createGlyphs(const DeviceLayout& layout) {
+        QList<Glyph> glyphs{createElements<Glyph>(layout.glyphs, layout.glyphCount)};
+        if (layout.matrix != nullptr)
+            glyphs.append(createElements<Glyph>(&layout.matrix->element, 1));
+        return glyphs;
+    }
+
+    template<typename T>
+    static QList<T> createElements(const GlyphLayout* elements, qsizetype count) {
+        QList<T> list;
+        list.reserve(count);
+        for (qsizetype i = 0; i < count; ++i) {
+            const GlyphLayout& e{elements[i]};
+            list.append(T{QString::fromLatin1(e.resource), e.reference, QPointF{e.offsetX, e.offsetY}, QString::fromLatin1(e.id)});
+        }
+        return list;
+    }
+
+    const ZoneMapping& zoneMappingFor(qsizetype zoneCount) const {
+        // Only one or two mappings per device
+        for (qsizetype i = 0; i < this->layout->zoneMappingCount; ++i) {
+            if (this->layout->zoneMappings[i].zoneCount == zoneCount)
+                return this->layout->zoneMappings[i];
+        }
+        throw std::logic_error("Invalid colors length! Got: " + std::to_string(zoneCount) + ", Expected: " + listToString(this->supportedZones).toStdString());
+    }
+
+    static QList<qsizetype> supportedZonesOf(const DeviceLayout& layout) {
+        QList<qsizetype> zones;
+        for (qsizetype i = 0; i < layout.zoneMappingCount; ++i)
+            zones.append(layout.zoneMappings[i].zoneCount);
+        return zones;
+    }
+};
+
+#endif // GV_DEVICECONFIGURATION_H
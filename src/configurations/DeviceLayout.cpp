@@ -0,0 +1,41 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "DeviceLayout.h"
+
+#include <iterator>
+
+// Generated from resources/layouts/*.json
+#include "DeviceLayoutData.h"
+
+const DeviceLayout* DeviceLayout::find(DeviceBuild build) {
+    for (const DeviceLayout& layout: DeviceLayoutData::layouts) {
+        if (layout.build == build)
+            return &layout;
+    }
+    return nullptr;
+}
+
+QList<DeviceBuild> DeviceLayout::builds() {
+    QList<DeviceBuild> builds;
+    builds.reserve(std::size(DeviceLayoutData::layouts));
+    for (const DeviceLayout& layout: DeviceLayoutData::layouts)
+        builds.append(layout.build);
+    return builds;
+}
@@ -0,0 +1,115 @@
+/*
+This file is part of the GlyphVisualizer project, a Glyph composition
+player that plays Glyph compositions from Nothing phones.
+Copyright (C) 2025  Sebastian Aigner (aka. SebiAi)
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef GV_DEVICELAYOUT_H
+#define GV_DEVICELAYOUT_H
+
+#include <QList>
+#include <QtGlobal>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+#include "DeviceBuild.h"
+#include "../MySvgRenderer.h"
+
+using namespace DeviceBuildNS;
+
+// The layouts are described in resources/layouts/*.json and compiled into constant tables at build time
+// (see cmake/GenerateDeviceLayouts.cmake) - nothing has to be parsed when a configuration is created.
+
+struct GlyphLayout {
+    const char* resource;
+    MySvgRenderer::Reference reference;
+    qreal offsetX;
+    qreal offsetY;
+    const char* id; // Element in the svg, empty for the whole file
+    qint16 alignAbove; // Index of an earlier glyph whose top is used as the bottom of the drawing area, -1 for none
+};
+
+// LED matrix that is rendered from a single svg (see GlyphMatrix)
+struct MatrixLayout {
+    GlyphLayout element;
+    int columns;
+    int rows;
+    qreal cellX; // First (top left) LED in svg units
+    qreal cellY;
+    qreal cellWidth;
+    qreal cellHeight;
+    qreal pitchX; // Distance between two cells in svg units
+    qreal pitchY;
+};
+
+// Which zone of the light data colors each glyph
+struct ZoneMapping {
+    qsizetype zoneCount;
+    qsizetype matrixZone; // Zone of the first matrix cell (the cells follow row by row), -1 if there is no matrix
+    const quint16* glyphZones; // One entry per glyph
+    // The same mapping from the other side: the glyphs of zone z are zoneGlyphs[zoneGlyphOffsets[z]] up to
+    // zoneGlyphs[zoneGlyphOffsets[z + 1]] (exclusive). Zones without glyphs have an empty range.
+    const quint16* zoneGlyphOffsets; // zoneCount + 1 entries
+    const quint16* zoneGlyphs; // One entry per glyph
+};
+
+template<std::size_t ZoneCount, std::size_t GlyphCount>
+struct ZoneFanOut {
+    std::array<quint16, ZoneCount + 1> offsets{};
+    std::array<quint16, GlyphCount> glyphs{};
+};
+
+// Inverts the glyph -> zone table of a layout at compile time (counting sort, glyphs keep their order within a zone).
+// A zone that is out of range makes the generated table fail to compile.
+template<std::size_t ZoneCount, std::size_t GlyphCount>
+constexpr ZoneFanOut<ZoneCount, GlyphCount> makeZoneFanOut(const std::array<quint16, GlyphCount>& glyphZones) {
+    static_assert(GlyphCount <= 0xffff, "Too many glyphs for 16 bit glyph indexes");
+
+    ZoneFanOut<ZoneCount, GlyphCount> fanOut{};
+    for (std::size_t glyph{0}; glyph < GlyphCount; ++glyph) {
+        if (glyphZones[glyph] >= ZoneCount)
+            throw std::logic_error("Glyph zone out of range!");
+        ++fanOut.offsets[glyphZones[glyph] + 1];
+    }
+    for (std::size_t zone{1}; zone <= ZoneCount; ++zone)
+        fanOut.offsets[zone] += fanOut.offsets[zone - 1];
+
+    std::array<quint16, ZoneCount + 1> next{fanOut.offsets};
+    for (std::size_t glyph{0}; glyph < GlyphCount; ++glyph)
+        fanOut.glyphs[next[glyphZones[glyph]]++] = (quint16)glyph;
+    return fanOut;
+}
+
+struct DeviceLayout {
+    DeviceBuild build;
+    int width;
+    int height;
+    const GlyphLayout* glyphs;
+    qsizetype glyphCount;
+    const GlyphLayout* decorations;
+    qsizetype decorationCount;
+    const MatrixLayout* matrix; // nullptr for none
+    const ZoneMapping* zoneMappings;
+    qsizetype zoneMappingCount;
+
+    // nullptr if there is no layout for the build
+    static const DeviceLayout* find(DeviceBuild build);
+    static QList<DeviceBuild> builds();
+};
+
+#endif // GV_DEVICELAYOUT_H
@@ -20,14 +20,25 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #ifndef GV_ICONFIGURATION_H
 #define GV_ICONFIGURATION_H
 
+#include <QByteArray>
 #include <QColor>
+#include <QFuture>
+#include <QHash>
+#include <QImage>
 #include <QList>
 #include <QPainter>
 #include <QRect>
+#include <QSharedPointer>
 #include <QSize>
+#include <QString>
+#include <QThread>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include "DeviceBuild.h"
+#include "../FrameStore.h"
 #include "../Glyph.h"
+#include "../GlyphMaskCache.h"
 #include "../MySvgRenderer.h"
 
 using namespace DeviceBuildNS;
@@ -36,14 +47,15 @@ class IConfiguration {
 public:
     const QColor fallbackColor;
     QList<Glyph> glyphs;
-    QList<QList<QColor>> parsedColors;
+    // The colors of the loaded composition - may still be filled while it is shown
+    QSharedPointer<FrameStore> frames;
     const DeviceBuild build;
     QList<qsizetype> supportedZones;
     const QSize sizeHint;
     QList<MySvgRenderer> decorations;
 
     IConfiguration(const QColor& fallbackColor, const QList<Glyph>& glyphs, const DeviceBuild& build, const QList<qsizetype>& supportedZones, const QSize& sizeHint, const QList<MySvgRenderer>& decorations = QList<MySvgRenderer>())
-        : fallbackColor{fallbackColor}, glyphs{glyphs}, parsedColors{}, build{build}, supportedZones{supportedZones}, sizeHint{sizeHint}, decorations{decorations}
+        : fallbackColor{fallbackColor}, glyphs{glyphs}, frames{}, build{build}, supportedZones{supportedZones}, sizeHint{sizeHint}, decorations{decorations}
     {
         if (!this->fallbackColor.isValid())
             throw std::logic_error("fallbackColor must be valid!");
@@ -51,8 +63,36 @@ public:
         if (this->supportedZones.isEmpty())
             throw std::logic_error("supportedZones must not be empty!");
     }
-    virtual ~IConfiguration() {}
+    virtual ~IConfiguration() { waitForBounds(); }
 
+    // Calculates the bounds and renders the glyph masks - must not run while the configuration is rendered
+    void updateBounds(const QRect& drawingArea, qreal scale) {
+        waitForBounds();
+        calcBounds(drawingArea, scale);
+        updateMasks(drawingArea.size());
+    }
+    // Same as updateBounds but on the global thread pool. The configuration must not be rendered until the future finished.
+    QFuture<void> updateBoundsAsync(const QRect& drawingArea, qreal scale) {
+        waitForBounds();
+        this->boundsFuture = QtConcurrent::run([this, drawingArea, scale]() {
+            calcBounds(drawingArea, scale);
+            updateMasks(drawingArea.size());
+        });
+        return this->boundsFuture;
+    }
+    // Blocks until a running updateBoundsAsync finished - call this before cloning a configuration that is shown somewhere
+    void waitForBounds() const { this->boundsFuture.waitForFinished(); }
+
+    // Gives all SVG renderers to the thread - only callable from the thread that constructed the configuration
+    void moveRenderersToThread(QThread* thread) {
+        for (MySvgRenderer& s: this->decorations)
+            s.moveToThread(thread);
+
+        for (Glyph& g: this->glyphs)
+            g.moveToThread(thread);
+    }
+
+    // Only calculates where everything goes - cheap
     virtual void calcBounds(const QRect& drawingArea, qreal scale) {
         for (MySvgRenderer& s: this->decorations)
             s.calcBounds(drawingArea, scale);
@@ -61,23 +101,68 @@ public:
             g.calcBounds(drawingArea, scale);
     }
 
-    void render(QPainter& painter, qsizetype colorIndex) {
-        // Get the color from the parsedColors or the fallbackColor
-        QList<QColor> colors = this->parsedColors.value(colorIndex, QList<QColor>(this->supportedZones[0], fallbackColor));
+    // Rasterizes the glyph masks for the current bounds - expensive, so every glyph gets rendered on the global thread pool
+    void renderMasks() {
+        QtConcurrent::blockingMap(this->glyphs, [](Glyph& g) { g.renderMask(); });
+    }
 
+    // Get the colors from the frames or the fallbackColor if the index is out of range (or not parsed yet).
+    // Readers that read many frames (in order) pass their own cursor, the others start at the keyframe every time.
+    QList<QColor> colorsAt(qsizetype colorIndex) const {
+        FrameStore::Cursor cursor{};
+        return colorsAt(colorIndex, cursor);
+    }
+    QList<QColor> colorsAt(qsizetype colorIndex, FrameStore::Cursor& cursor) const {
+        if (!this->frames.isNull() && colorIndex >= 0 && colorIndex < this->frames->frameCount())
+            return this->frames->at(colorIndex, cursor);
+
+        // Use the zone count of the loaded composition so the fallback can be mixed with real colors
+        return QList<QColor>(this->frames.isNull() ? this->supportedZones[0] : this->frames->zoneCount(), this->fallbackColor);
+    }
+
+    void render(QPainter& painter, qsizetype colorIndex) {
+        renderPrivate(painter, colorsAt(colorIndex));
+    }
+    void renderColors(QPainter& painter, const QList<QColor>& colors) {
         renderPrivate(painter, colors);
     }
+    // Everything that does not depend on the colors
+    void renderDecorations(QPainter& painter) {
+        for (MySvgRenderer& s: this->decorations)
+            s.render(&painter);
+    }
+
+    // Turns image - a frame rendered with previousColors - into the frame for colors by only redrawing the glyphs whose color changed.
+    // base must be the same frame without any glyphs (see renderDecorations). Returns false if that is not possible and
+    // the frame has to be rendered completely instead.
+    virtual bool renderChanges(QImage& image, const QImage& base, const QList<QColor>& colors, const QList<QColor>& previousColors) {
+        Q_UNUSED(image); Q_UNUSED(base); Q_UNUSED(colors); Q_UNUSED(previousColors);
+        return false;
+    }
 
     virtual IConfiguration* clone() const = 0;
 
 protected:
+    mutable QFuture<void> boundsFuture;
+    // The hashes of the SVG files for the GlyphMaskCache keys - hashing them again on every resize is expensive
+    QHash<QString, QByteArray> resourceHashes;
+
+    // Takes the masks from the GlyphMaskCache or renders and caches them
+    void updateMasks(const QSize& targetSize) {
+        QByteArray cacheKey{GlyphMaskCache::calcKey(this->glyphs, this->resourceHashes)};
+        if (GlyphMaskCache::load(this->build, targetSize, cacheKey, this->glyphs))
+            return;
+
+        renderMasks();
+        GlyphMaskCache::store(this->build, targetSize, cacheKey, this->glyphs);
+    }
+
     virtual void renderPrivate(QPainter& painter, const QList<QColor>& colors) {
         if (this->glyphs.size() != colors.size())
             throw std::logic_error("The default implementation expects equal size of glyphs and colors!");
 
         // Render the decorations first because we always want to see the glyphs
-        for (MySvgRenderer& s: this->decorations)
-            s.render(&painter);
+        renderDecorations(painter);
 
         // Render the glyphs second to render over any decorations that render to the same spot
         for (qsizetype i = 0; i < colors.size(); ++i)
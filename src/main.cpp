@@ -31,6 +31,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "Config.h"
 #include "BuildInfo.h"
 #include "OpenCompositionDialog.h"
+#include "StartupTrace.h"
 #include "Utils.h"
 #include "WindowsLoggingWorkaround.h"
 
@@ -48,7 +49,9 @@ int main(int argc, char *argv[])
     // Does nothing on other platforms than Windows
     WindowsLoggingWorkaround wlw;
 
+    qint64 applicationStartNS{StartupTrace::elapsedNS()};
     QApplication a(argc, argv);
+    StartupTrace::addCompleteEvent(QStringLiteral("QApplication creation"), applicationStartNS);
     QCoreApplication::setOrganizationName(QStringLiteral("SebiAi"));
     QCoreApplication::setOrganizationDomain(QStringLiteral("com.sebiai"));
     QCoreApplication::setApplicationName(QStringLiteral("GlyphVisualizer"));
@@ -73,6 +76,11 @@ int main(int argc, char *argv[])
         // Add verbose logging option
         QCommandLineOption verboseLogging("verbose", "Enable verbose logging.");
         parser.addOption(verboseLogging);
+        // Add startup trace options
+        QCommandLineOption startupTraceOption("startup-trace", "Write a trace of the application start (until the first frame is painted) to <file>.", "file");
+        parser.addOption(startupTraceOption);
+        QCommandLineOption exitAfterStartupOption("exit-after-startup", "Exit once the startup trace was written (used for benchmarking).");
+        parser.addOption(exitAfterStartupOption);
 
         // Parse command line options
         parser.process(a);
@@ -85,6 +93,12 @@ int main(int argc, char *argv[])
         }
         else QLoggingCategory::setFilterRules("*.Verbose=false");
 
+        // Set startup trace
+        if (parser.isSet(startupTraceOption)) {
+            StartupTrace::setOutput(parser.value(startupTraceOption), parser.isSet(exitAfterStartupOption));
+            qCInfo(mainFunctionVerbose) << "Writing startup trace to" << parser.value(startupTraceOption);
+        }
+
         qCInfo(mainFunctionVerbose) << "#### Software Information #####";
         qCInfo(mainFunctionVerbose) << "Current software version:" << BUILDINFO_VERSION;
         qCInfo(mainFunctionVerbose) << "Current software git hash:" << BUILDINFO_GIT_COMMIT_HASH;
@@ -100,6 +114,7 @@ int main(int argc, char *argv[])
         bool resetConfig{false};
         do {
             try {
+                StartupTrace::Scope scope{QStringLiteral("Config::load")};
                 config.load(getAppConfigLocation().absoluteFilePath(QStringLiteral("GlyphVisualizer.ini")), resetConfig);
                 resetConfig = false;
             } catch (const Config::ConfigVersionTooHighError& e) {
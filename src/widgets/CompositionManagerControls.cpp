@@ -41,6 +41,7 @@ CompositionManagerControls::CompositionManagerControls(CompositionManager* cm, Q
     // Connect signals
     connect(this->playPauseButton, &PlayPauseButton::clicked, this, &CompositionManagerControls::onPlayPauseButtonClicked);
     connect(this->seekBar, &SeekBar::seek, this, &CompositionManagerControls::onSeekBarSeek);
+    connect(this->seekBar, &SeekBar::scrub, this, &CompositionManagerControls::onSeekBarScrub);
     connect(this->seekBar, &SeekBar::percentageSeek, this, &CompositionManagerControls::onSeekBarPercentageSeek);
     connect(this->cm, &CompositionManager::playbackStateChanged, this, &CompositionManagerControls::onCompositionManagerPlaybackStateChanged);
     connect(this->cm, &CompositionManager::durationChanged, this, &CompositionManagerControls::onCompositionManagerDurationChanged);
@@ -72,6 +73,13 @@ void CompositionManagerControls::onSeekBarSeek() {
     this->cm->seek(this->seekBar->sliderPosition());
 }
 
+void CompositionManagerControls::onSeekBarScrub(int position) {
+    // The audio still plays at the old position - show where the slider is
+    this->currentTimeLabel->setMS(position);
+
+    this->cm->scrub(position);
+}
+
 void CompositionManagerControls::onSeekBarPercentageSeek(qreal percent) {
     qCInfo(compositionManagerControlsVerbose).nospace() << "Seeking to percentage " << percent * 100 << "% (" << this->seekBar->maximum() * percent << " ms)";
 
@@ -103,6 +111,7 @@ void CompositionManagerControls::onCompositionManagerDurationChanged(qint64 dura
 void CompositionManagerControls::onCompositionManagerPositionChanged(qint64 position) {
     // Update SeekBar
     this->seekBar->updatePosition((int)position);
-    // Update current time label
-    this->currentTimeLabel->setMS(position);
+    // Update current time label - unless the slider is dragged (see onSeekBarScrub)
+    if (!this->seekBar->isSliderDown())
+        this->currentTimeLabel->setMS(position);
 }
@@ -56,6 +56,7 @@ private:
 private slots:
     void onPlayPauseButtonClicked();
     void onSeekBarSeek();
+    void onSeekBarScrub(int position);
     void onSeekBarPercentageSeek(qreal percent);
     void onCompositionManagerPlaybackStateChanged(QMediaPlayer::PlaybackState newState);
     void onCompositionManagerDurationChanged(qint64 duration);
@@ -26,13 +26,25 @@ Q_LOGGING_CATEGORY(glyphWidgetVerbose, "GlyphWidget.Verbose")
 const QColor GlyphWidget::phoneBackgroundColor{QStringLiteral("#2f3033")};
 
 GlyphWidget::GlyphWidget(IConfiguration* configuration, QWidget *parent)
-    : QWidget{parent}, paintRect{}, sizeRatio{1.0}, index{0}
+    : QWidget{parent}, geometry{}, targetGeometry{}, resizeTimer{new QTimer{this}}, boundsWatcher{new QFutureWatcher<void>{this}},
+    jobGeometry{}, boundsGeneration{0}, jobGeneration{0}, frameBuffer{}, frameBufferLeased{false}, prefetcher{}, baseImage{}, baseGeometry{}, baseBackgroundColor{}, baseConfiguration{nullptr},
+    configuration{nullptr}, index{0}, framesCursor{}
 {
     // Set size policy to constrain minimum window size + expand
     setSizePolicy(QSizePolicy(QSizePolicy::Policy::MinimumExpanding, QSizePolicy::Policy::MinimumExpanding));
 
+    this->resizeTimer->setSingleShot(true);
+    this->resizeTimer->setInterval(GlyphWidget::resizeDebounceMS);
+    connect(this->resizeTimer, &QTimer::timeout, this, &GlyphWidget::startBoundsUpdate);
+    connect(this->boundsWatcher, &QFutureWatcher<void>::finished, this, &GlyphWidget::onBoundsUpdated);
+
     setConfiguration(configuration);
 }
+GlyphWidget::~GlyphWidget() {
+    // The running jobs use the configuration
+    this->prefetcher.stop();
+    this->boundsWatcher->waitForFinished();
+}
 
 void GlyphWidget::setConfiguration(IConfiguration* configuration) {
     if (configuration == nullptr)
@@ -40,20 +52,35 @@ void GlyphWidget::setConfiguration(IConfiguration* configuration) {
 
     qCInfo(glyphWidget) << "Setting configuration to" << configuration->build;
 
+    // Let the running jobs on the old configuration finish first
+    this->prefetcher.stop();
+    this->boundsWatcher->waitForFinished();
+
     this->configuration = configuration;
     // Resize and update the widget
-    QResizeEvent rEvent{size(), size()};
-    resizeEvent(&rEvent);
+    callResizeEvent();
     update();
 }
 
 void GlyphWidget::render(qsizetype colorIndex) {
     this->index = colorIndex;
+
+    // Render the next frames in the background - but only for bounds that are going to stay
+    if (!this->prefetcher.isStarted() && !this->boundsWatcher->isRunning() && this->geometry == this->targetGeometry) {
+        // The same as the frame of the paintEvent without any glyphs
+        updateBaseImage(Qt::GlobalColor::transparent, QImage::Format::Format_ARGB32_Premultiplied);
+        this->prefetcher.start(this->configuration, this->baseImage, this->geometry.pixelRatio);
+    }
+    this->prefetcher.request(colorIndex);
     update();
 }
 QImage GlyphWidget::renderRGB32Image(qsizetype colorIndex, const QColor backgroundColor) {
-    // Create image - use RGB32 because it better optimized for QPainter
-    QImage image{size(), QImage::Format::Format_RGB32};
+    this->index = colorIndex;
+    return renderRGB32Image(this->configuration->colorsAt(colorIndex, this->framesCursor), backgroundColor);
+}
+QImage GlyphWidget::renderRGB32Image(const QList<QColor>& colors, const QColor backgroundColor) {
+    // Create image - use RGB32 because it better optimized for QPainter and the glyph compositor
+    QImage image{deviceSize(), QImage::Format::Format_RGB32};
     image.fill(backgroundColor);
 
     // Create the painter
@@ -61,28 +88,103 @@ QImage GlyphWidget::renderRGB32Image(qsizetype colorIndex, const QColor backgrou
     painter.setRenderHint(QPainter::RenderHint::Antialiasing);
 
     // Paint the phone
-    this->index = colorIndex;
-    paintPhone(painter);
+    paintPhone(painter, colors);
 
     painter.end();
 
     return image;
 }
+bool GlyphWidget::updateRGB32Image(QImage& image, const QList<QColor>& colors, const QList<QColor>& previousColors, const QColor backgroundColor) {
+    if (image.size() != deviceSize() || image.format() != QImage::Format::Format_RGB32)
+        return false;
+
+    updateBaseImage(backgroundColor, image.format());
+    return this->configuration->renderChanges(image, this->baseImage, colors, previousColors);
+}
+
+void GlyphWidget::updateBaseImage(const QColor& backgroundColor, QImage::Format format) {
+    if (!this->baseImage.isNull() && this->baseImage.size() == deviceSize() && this->baseImage.format() == format && this->baseGeometry == this->geometry
+        && this->baseBackgroundColor == backgroundColor && this->baseConfiguration == this->configuration)
+        return;
+
+    qCInfo(glyphWidgetVerbose) << "Rendering the base image for" << this->geometry.paintRect;
+
+    // Exactly the steps of renderRGB32Image - just without the glyphs
+    this->baseImage = QImage{deviceSize(), format};
+    this->baseImage.fill(backgroundColor);
+
+    QPainter painter{&this->baseImage};
+    painter.setRenderHint(QPainter::RenderHint::Antialiasing);
+    paintPhoneBackground(painter);
+    this->configuration->renderDecorations(painter);
+    painter.end();
+
+    this->baseGeometry = this->geometry;
+    this->baseBackgroundColor = backgroundColor;
+    this->baseConfiguration = this->configuration;
+}
 
 void GlyphWidget::resizeEvent(QResizeEvent* event) {
     Q_UNUSED(event);
 
+    calcTargetGeometry();
+
+    // Widgets that are not shown can update right away - nobody sees them stutter
+    if (!isVisible()) {
+        updateBoundsNow();
+        return;
+    }
+
+    this->resizeTimer->start(); // Restarts the timer if it is already running
+    update();
+}
+
+void GlyphWidget::calcTargetGeometry() {
+    this->targetGeometry.pixelRatio = currentPixelRatio();
+    QSize deviceSize{(size().toSizeF() * this->targetGeometry.pixelRatio).toSize()};
+
     // Scale sizeHint while keeping the aspect ratio
-    this->paintRect.setSize(sizeHint().scaled(size(), Qt::AspectRatioMode::KeepAspectRatio));
+    this->targetGeometry.paintRect.setSize(sizeHint().scaled(deviceSize, Qt::AspectRatioMode::KeepAspectRatio));
 
     // Center the painting rectangle in the drawing area
-    this->paintRect.moveCenter(rect().center());
+    this->targetGeometry.paintRect.moveCenter(QRect{QPoint{0, 0}, deviceSize}.center());
 
     // Calculate the size ratio
-    this->sizeRatio = (qreal)this->paintRect.height() / sizeHint().height();
+    this->targetGeometry.sizeRatio = (qreal)this->targetGeometry.paintRect.height() / sizeHint().height();
+}
+
+void GlyphWidget::updateBoundsNow() {
+    this->resizeTimer->stop();
+    this->prefetcher.stop();
+    this->boundsWatcher->waitForFinished();
+    this->boundsGeneration++; // Results of older jobs must not be applied anymore
 
     // Calculate bounds for configuration
-    this->configuration->calcBounds(this->paintRect, this->sizeRatio);
+    this->configuration->updateBounds(this->targetGeometry.paintRect, this->targetGeometry.sizeRatio);
+    this->geometry = this->targetGeometry;
+}
+
+void GlyphWidget::startBoundsUpdate() {
+    // Only one job at a time - onBoundsUpdated starts the next one if the size changed in the meantime
+    if (this->boundsWatcher->isRunning())
+        return;
+
+    qCInfo(glyphWidgetVerbose) << "Updating bounds in the background for" << this->targetGeometry.paintRect;
+    this->prefetcher.stop(); // Its frames are for the old bounds
+    this->jobGeometry = this->targetGeometry;
+    this->jobGeneration = ++this->boundsGeneration;
+    this->boundsWatcher->setFuture(this->configuration->updateBoundsAsync(this->jobGeometry.paintRect, this->jobGeometry.sizeRatio));
+}
+
+void GlyphWidget::onBoundsUpdated() {
+    if (this->jobGeneration == this->boundsGeneration)
+        this->geometry = this->jobGeometry;
+
+    // The widget was resized again while the job was running
+    if (this->geometry != this->targetGeometry && !this->resizeTimer->isActive())
+        startBoundsUpdate();
+
+    update();
 }
 
 QSize GlyphWidget::sizeHint() const { return this->configuration->sizeHint; }
@@ -90,20 +192,81 @@ QSize GlyphWidget::sizeHint() const { return this->configuration->sizeHint; }
 void GlyphWidget::paintEvent(QPaintEvent* event) {
     Q_UNUSED(event);
 
+    // The widget may have been moved to a screen with a different scaling
+    if (this->targetGeometry.pixelRatio != currentPixelRatio()) {
+        calcTargetGeometry();
+        this->resizeTimer->start();
+    }
+
+    // The bounds of the configuration must not be touched while they are updated
+    if (this->boundsWatcher->isRunning() || this->geometry != this->targetGeometry) {
+        paintStaleFrame();
+        return;
+    }
+
+    // Drop the leased frame first, so the prefetcher can render the next frames into its slot without copying it
+    if (this->frameBufferLeased) {
+        this->frameBuffer = QImage{};
+        this->frameBufferLeased = false;
+    }
+
+    // A frame that was rendered ahead only has to be drawn - it is also what paintStaleFrame shows
+    QImage prefetchedFrame{this->prefetcher.isStarted() ? this->prefetcher.leaseFrame(this->index) : QImage{}};
+    if (!prefetchedFrame.isNull()) {
+        this->frameBuffer = prefetchedFrame;
+        this->frameBufferLeased = true;
+    } else {
+        // Composite the frame in device pixels
+        QSize deviceSize{this->deviceSize()};
+        if (this->frameBuffer.size() != deviceSize)
+            this->frameBuffer = QImage{deviceSize, QImage::Format::Format_ARGB32_Premultiplied};
+        this->frameBuffer.setDevicePixelRatio(1.0); // Or the painter would scale everything
+        this->frameBuffer.fill(Qt::GlobalColor::transparent);
+
+        QMutexLocker locker{&this->prefetcher.renderMutex()};
+        QPainter bufferPainter{&this->frameBuffer};
+        bufferPainter.setRenderHint(QPainter::RenderHint::Antialiasing);
+        paintPhone(bufferPainter, this->configuration->colorsAt(this->index, this->framesCursor));
+        bufferPainter.end();
+    }
+
+    // Draw it 1:1 to the screen
+    this->frameBuffer.setDevicePixelRatio(this->geometry.pixelRatio);
     QPainter painter{this};
-    painter.setRenderHint(QPainter::RenderHint::Antialiasing);
+    painter.drawImage(QPoint{0, 0}, this->frameBuffer);
+    painter.end();
+
+    emit framePainted(this->index);
+    StartupTrace::firstPaint();
+}
 
-    paintPhone(painter);
+void GlyphWidget::paintStaleFrame() {
+    if (this->frameBuffer.isNull())
+        return;
 
+    // Scale the phone of the last frame to where the phone will be once the new bounds are ready
+    QRectF target{QRectF{this->targetGeometry.paintRect}.topLeft() / this->targetGeometry.pixelRatio,
+                  QRectF{this->targetGeometry.paintRect}.size() / this->targetGeometry.pixelRatio};
+    QPainter painter{this};
+    painter.setRenderHint(QPainter::RenderHint::SmoothPixmapTransform);
+    painter.drawImage(target, this->frameBuffer, QRectF{this->geometry.paintRect});
     painter.end();
 }
 
-void GlyphWidget::paintPhone(QPainter& painter) {
+qreal GlyphWidget::currentPixelRatio() const {
+    // Widgets that were never shown (e.g. the one used for rendering videos) always paint 1:1
+    return window()->windowHandle() ? devicePixelRatioF() : 1.0;
+}
+
+void GlyphWidget::paintPhone(QPainter& painter, const QList<QColor>& colors) {
     // Render the background
-    painter.setPen(Qt::PenStyle::NoPen);
-    painter.setBrush(GlyphWidget::phoneBackgroundColor);
-    painter.drawRoundedRect(this->paintRect, 22 * this->sizeRatio, 22 * this->sizeRatio);
+    paintPhoneBackground(painter);
 
     // Rerender all glyphs
-    this->configuration->render(painter, this->index);
+    this->configuration->renderColors(painter, colors);
+}
+void GlyphWidget::paintPhoneBackground(QPainter& painter) {
+    painter.setPen(Qt::PenStyle::NoPen);
+    painter.setBrush(GlyphWidget::phoneBackgroundColor);
+    painter.drawRoundedRect(this->geometry.paintRect, 22 * this->geometry.sizeRatio, 22 * this->geometry.sizeRatio);
 }
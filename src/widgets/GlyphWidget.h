@@ -21,6 +21,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define GV_GLYPHWIDGET_H
 
 #include <QColor>
+#include <QFutureWatcher>
 #include <QImage>
 #include <QPainter>
 #include <QPaintEvent>
@@ -29,9 +30,13 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include <QSize>
 #include <QSizePolicy>
 #include <QStringLiteral>
+#include <QTimer>
 #include <QWidget>
+#include <QWindow>
 
 #include "../configurations/IConfiguration.h"
+#include "../FramePrefetcher.h"
+#include "../StartupTrace.h"
 
 // Logging
 #include <QLoggingCategory>
@@ -43,15 +48,25 @@ class GlyphWidget : public QWidget
     Q_OBJECT
 public:
     explicit GlyphWidget(IConfiguration* configuration, QWidget *parent = nullptr);
+    ~GlyphWidget();
 
     DeviceBuild getConfigurationDeviceBuild() { return this->configuration->build; }
+    // Waits until the configuration is not rendered in the background anymore (e.g. before it is cloned) - restarted by the next render
+    void stopPrefetching() { this->prefetcher.stop(); }
 signals:
+    // The frame of index is on the screen (only emitted for up to date bounds)
+    void framePainted(qsizetype index);
 
 public slots:
     void setConfiguration(IConfiguration* configuration);
     void render(qsizetype colorIndex);
     QImage renderRGB32Image(qsizetype colorIndex, const QColor backgroundColor);
-    void callResizeEvent() { QResizeEvent event{size(), size()}; resizeEvent(&event); }
+    QImage renderRGB32Image(const QList<QColor>& colors, const QColor backgroundColor);
+    // Turns image - the last result of renderRGB32Image for previousColors - into the frame for colors by only
+    // redrawing what changed. Returns false if image has to be rendered with renderRGB32Image instead.
+    bool updateRGB32Image(QImage& image, const QList<QColor>& colors, const QList<QColor>& previousColors, const QColor backgroundColor);
+    // Updates the bounds for the current size synchronously (also for visible widgets)
+    void callResizeEvent() { calcTargetGeometry(); updateBoundsNow(); }
 
 protected:
     virtual void resizeEvent(QResizeEvent* event) override;
@@ -59,12 +74,46 @@ protected:
     virtual void paintEvent(QPaintEvent* event) override;
 
 private:
-    // Holds the size and the position of the painting area - is calculated in the resizeEvent and used in the paintEvent.
-    QRect paintRect;
-
-    // Holds the ratio between the height of the widget size and the height of the drawingRectangle height
-    // (always bigger than 1) - is calculated in the resizeEvent.
-    qreal sizeRatio;
+    // Everything is painted in device pixels so the glyph masks match the screen pixels 1:1.
+    struct Geometry {
+        // The device pixel ratio the geometry was calculated for
+        qreal pixelRatio{1.0};
+        // The size and the position of the painting area in device pixels
+        QRect paintRect{};
+        // The ratio between the height of the painting area and the height of the sizeHint
+        qreal sizeRatio{1.0};
+
+        bool operator==(const Geometry& other) const { return this->pixelRatio == other.pixelRatio && this->paintRect == other.paintRect && this->sizeRatio == other.sizeRatio; }
+        bool operator!=(const Geometry& other) const { return !(*this == other); }
+    };
+
+    // The geometry the configuration bounds are calculated for - used in the paintEvent
+    Geometry geometry;
+    // The geometry for the current widget size - is calculated in the resizeEvent and applied once the masks for it are ready
+    Geometry targetGeometry;
+
+    // Rendering the masks takes a while for big sizes, so visible widgets update their bounds in the background
+    // after the resizing stopped for resizeDebounceMS. In the meantime the last frame is shown scaled.
+    static constexpr int resizeDebounceMS{100};
+    QTimer* resizeTimer;
+    QFutureWatcher<void>* boundsWatcher;
+    Geometry jobGeometry;
+    qint64 boundsGeneration;
+    qint64 jobGeneration;
+
+    // The frame is composited in this image (device pixels) and then drawn to the widget
+    QImage frameBuffer;
+    // True if frameBuffer is the image of a slot of the prefetcher (see FramePrefetcher::leaseFrame)
+    bool frameBufferLeased;
+
+    // Renders the frames after the one that is shown while playing - started once the bounds are ready
+    FramePrefetcher prefetcher;
+
+    // The phone without any glyphs for updateRGB32Image and what it was rendered for
+    QImage baseImage;
+    Geometry baseGeometry;
+    QColor baseBackgroundColor;
+    IConfiguration* baseConfiguration;
 
     // Holds the current configuration. The configuration object is owned by the ConfigurationManager.
     IConfiguration* configuration;
@@ -72,8 +121,21 @@ private:
     static const QColor phoneBackgroundColor;
 
     qsizetype index;
-
-    void paintPhone(QPainter& painter);
+    // Where this widget reads the frames of the configuration (see FrameStore::Cursor)
+    FrameStore::Cursor framesCursor;
+
+    qreal currentPixelRatio() const;
+    QSize deviceSize() const { return (size().toSizeF() * this->geometry.pixelRatio).toSize(); }
+    void calcTargetGeometry();
+    void updateBoundsNow();
+    void startBoundsUpdate();
+    void paintStaleFrame();
+    void paintPhone(QPainter& painter, const QList<QColor>& colors);
+    void paintPhoneBackground(QPainter& painter);
+    void updateBaseImage(const QColor& backgroundColor, QImage::Format format);
+
+private slots:
+    void onBoundsUpdated();
 };
 
 #endif // GV_GLYPHWIDGET_H
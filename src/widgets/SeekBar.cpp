@@ -36,6 +36,7 @@ SeekBar::SeekBar(QWidget* parent)
     // Update the widget when the value changes
     connect(this, &QSlider::valueChanged, this, &SeekBar::calculateSubPage);
 
+    connect(this, &QSlider::sliderMoved, this, &SeekBar::scrub);
     connect(this, &QSlider::sliderReleased, this, &SeekBar::onSliderReleased);
     connect(this, &QAbstractSlider::actionTriggered, this, &SeekBar::onActionTriggered);
 
@@ -41,6 +41,8 @@ public:
 
 signals:
     void seek(int position);
+    // Emitted while the slider is dragged - seek follows once it is released
+    void scrub(int position);
     void percentageSeek(qreal percent);
 
 public slots: